@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/matx.hpp>
+
+#include "detectors/ObjectOccupancyMask.hpp"
+#include "helpers/Globals.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class HoughLineClassifier
+     * @brief Classifies hough lines as left, middle or right lane lines, discarding those that are vertical, horizontal,
+     * within an object bounding box or along an edge of the region-of-interest mask. The lines are copied in to
+     * structure-of-arrays float buffers so that the gradient, edge and threshold checks and the lengths are computed several
+     * lines at a time, after which only the object bounding box check is made per line. The gradients and line equations are
+     * evaluated in double precision, so lines exactly on a threshold are classified the same as in `ClassifyLine()`.
+     */
+    class HoughLineClassifier
+    {
+    public:
+        /**
+         * @brief Constructs a new %HoughLineClassifier object.
+         */
+        explicit HoughLineClassifier();
+
+        /**
+         * @brief Classifies each of `p_houghLines`.
+         *
+         * @param p_houghLines The hough lines to classify, in reference co-ordinates.
+         * @param p_objectOccupancyMask The object bounding boxes of the current frame.
+         */
+        void Run(const std::vector<cv::Vec4i>& p_houghLines, ObjectOccupancyMask& p_objectOccupancyMask);
+
+        /**
+         * @brief Get the type of each hough line passed to the last call to `Run()`.
+         *
+         * @return `const std::vector<Globals::HoughLineTypes>&` The type of each hough line.
+         */
+        const std::vector<Globals::HoughLineTypes>& GetLineTypes();
+
+        /**
+         * @brief Get the indices of the hough lines classified as left, middle or right lane lines by the last call to
+         * `Run()`, in the order that they were passed.
+         *
+         * @return `const std::vector<uint32_t>&` The indices of the lane lines.
+         */
+        ///@{
+        const std::vector<uint32_t>& GetLeftLineIndices();
+        const std::vector<uint32_t>& GetMiddleLineIndices();
+        const std::vector<uint32_t>& GetRightLineIndices();
+        ///@}
+
+        /**
+         * @brief Get the average length of the left, middle or right lane lines, which is not a number if there are none.
+         *
+         * @return `double` The average length of the lane lines.
+         */
+        ///@{
+        double GetLeftLineAverageLength();
+        double GetMiddleLineAverageLength();
+        double GetRightLineAverageLength();
+        ///@}
+
+    private:
+        /**
+         * @brief Classifies a single line without the object bounding box check, with the same checks as the vectorised loop
+         * in `Run()`.
+         *
+         * @param p_x1 The x co-ordinate of the first end of the line.
+         * @param p_y1 The y co-ordinate of the first end of the line.
+         * @param p_x2 The x co-ordinate of the second end of the line.
+         * @param p_y2 The y co-ordinate of the second end of the line.
+         * @return `Globals::HoughLineTypes` The type of the line.
+         */
+        static Globals::HoughLineTypes ClassifyLine(const float& p_x1, const float& p_y1, const float& p_x2, const float& p_y2);
+
+        /**
+         * @brief The co-ordinates of the ends of the hough lines, which are reused between frames.
+         */
+        ///@{
+        std::vector<float> m_x1;
+        std::vector<float> m_y1;
+        std::vector<float> m_x2;
+        std::vector<float> m_y2;
+        ///@}
+
+        /**
+         * @brief The lengths of the hough lines.
+         */
+        std::vector<float> m_lengths;
+
+        /**
+         * @brief The types of the hough lines before the object bounding box check, as `Globals::HoughLineTypes` values
+         * widened to the width of a float lane.
+         */
+        std::vector<int32_t> m_geometricLineTypes;
+
+        /**
+         * @brief The types of the hough lines.
+         */
+        std::vector<Globals::HoughLineTypes> m_lineTypes;
+
+        /**
+         * @brief The indices of the left, middle and right lane lines.
+         */
+        ///@{
+        std::vector<uint32_t> m_leftLineIndices;
+        std::vector<uint32_t> m_middleLineIndices;
+        std::vector<uint32_t> m_rightLineIndices;
+        ///@}
+
+        /**
+         * @brief The total length of the left, middle and right lane lines.
+         */
+        ///@{
+        double m_leftLineTotalLength;
+        double m_middleLineTotalLength;
+        double m_rightLineTotalLength;
+        ///@}
+    };
+}
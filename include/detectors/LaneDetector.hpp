@@ -2,11 +2,16 @@
 
 #include <cstdint>
 #include <deque>
+#include <memory>
 #include <vector>
 
 #include <opencv2/core/mat.hpp>
 #include <opencv2/core/matx.hpp>
+#include <opencv2/core/types.hpp>
 
+#include "detectors/HoughLineClassifier.hpp"
+#include "detectors/ObjectOccupancyMask.hpp"
+#include "helpers/FrameGeometry.hpp"
 #include "helpers/Globals.hpp"
 #include "helpers/Information.hpp"
 
@@ -34,37 +39,69 @@ namespace LaneAndObjectDetection
          * @param p_frame The frame to run the lane detector against.
          * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing all object detection-related
          * information.
-         * @param p_debugMode Whether in debug mode.
          */
-        void RunLaneDetector(const cv::Mat& p_frame, const ObjectDetectionInformation& p_objectDetectionInformation, const bool& p_debugMode);
+        void RunLaneDetector(const cv::Mat& p_frame, const ObjectDetectionInformation& p_objectDetectionInformation);
 
         /**
-         * @brief Get the LaneDetectionInformation struct.
+         * @brief Runs the stages of the lane detector that do not depend upon the object detector (the region-of-interest
+         * mask, greyscale conversion, Canny algorithm and Hough transform) against `p_frame`. This allows them to run
+         * concurrently with the object detector, after which `RunLaneDetectorBackEnd()` must be called.
          *
-         * @return LaneDetectionInformation The LaneDetectionInformation struct.
+         * @param p_frame The frame to run the lane detector against.
          */
-        LaneDetectionInformation GetInformation();
+        void RunLaneDetectorFrontEnd(const cv::Mat& p_frame);
 
-    private:
         /**
-         * @brief Determines whether the detected hough lines are left, middle or right lane lines. The majority of the noise
-         * removal occurs here.
+         * @brief Runs the stages of the lane detector that depend upon the object detector (filtering and classifying the hough
+         * lines found by `RunLaneDetectorFrontEnd()`) and updates the driving state.
          *
-         * @param p_houghLines The hough lines that have been detected.
-         * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing the object bounding boxes.
-         * @param p_debugMode Whether in debug mode.
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing all object detection-related
+         * information for the frame passed to `RunLaneDetectorFrontEnd()`.
+         */
+        void RunLaneDetectorBackEnd(const ObjectDetectionInformation& p_objectDetectionInformation);
+
+        /**
+         * @brief Get the LaneDetectionInformation struct without copying it. The reference is only valid until the lane
+         * detector is next run.
+         *
+         * @return `const LaneDetectionInformation&` The LaneDetectionInformation struct.
+         */
+        const LaneDetectionInformation& GetInformation();
+
+        /**
+         * @brief Get an immutable snapshot of the LaneDetectionInformation struct which can be safely handed to other threads
+         * without copying it. The lane detector never writes to a snapshot that is still held, instead it copies on write.
+         *
+         * @return `std::shared_ptr<const LaneDetectionInformation>` The LaneDetectionInformation struct.
+         */
+        std::shared_ptr<const LaneDetectionInformation> GetInformationSnapshot();
+
+        /**
+         * @brief Set the resolution that the region-of-interest is processed at. The Hough transform parameters are scaled to
+         * match and the detected lines are mapped back to reference co-ordinates, so all other lane geometry is unaffected.
+         *
+         * @param p_scale The factor that the region-of-interest is downscaled by.
+         */
+        void SetScale(const Globals::LaneDetectorScales& p_scale);
+
+        /**
+         * @brief Set the geometry of the frames that the lane detector will be run against. The lines are classified at the
+         * reference resolution, so detected lines are mapped to reference co-ordinates and the lane overlay is mapped back to
+         * frame co-ordinates.
+         *
+         * @param p_frameGeometry The geometry of the input frames.
          */
-        void AnalyseHoughLines(const std::vector<cv::Vec4i>& p_houghLines, const ObjectDetectionInformation& p_objectDetectionInformation, const bool& p_debugMode);
+        void SetFrameGeometry(const FrameGeometry& p_frameGeometry);
 
+    private:
         /**
-         * @brief Determines whether `p_houghLine` is within any one of the `p_objectDetectionInformation` object bounding boxes.
+         * @brief Determines whether the detected hough lines are left, middle or right lane lines. The majority of the noise
+         * removal occurs here. The hough lines and their types are recorded in the LaneDetectionInformation struct for the
+         * debug frames.
          *
-         * @param p_houghLine The line to check.
          * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing the object bounding boxes.
-         * @return true If `p_houghLine` is within the object bounding boxes found within `p_objectDetectionInformation`.
-         * @return false If `p_houghLine` is NOT within the object bounding boxes found within `p_objectDetectionInformation`.
          */
-        static bool IsLineWithinObjectBoundingBoxes(const cv::Vec4i& p_houghLine, const ObjectDetectionInformation& p_objectDetectionInformation);
+        void AnalyseHoughLines(const ObjectDetectionInformation& p_objectDetectionInformation);
 
         /**
          * @brief Determines whether the left, middle, and right lane lines detected are solid, dashed or empty.
@@ -125,7 +162,7 @@ namespace LaneAndObjectDetection
         /**
          * @brief The LaneDetectionInformation struct containing all lane detection-related information.
          */
-        LaneDetectionInformation m_laneDetectionInformation;
+        std::shared_ptr<LaneDetectionInformation> m_laneDetectionInformation;
 
         /**
          * @brief The rolling average to determine the driving state.
@@ -138,28 +175,68 @@ namespace LaneAndObjectDetection
         Globals::DrivingState m_currentDrivingState;
 
         /**
-         * @brief The left, middle and right lane lines that have been detected for the current frame.
+         * @brief The columns of the (scaled) ROI bounding box covered by the ROI mask for each of its rows, which are only
+         * calculated when the scale or frame geometry changes.
          */
-        ///@{
-        std::vector<cv::Vec4i> m_leftLaneLines;
-        std::vector<cv::Vec4i> m_middleLaneLines;
-        std::vector<cv::Vec4i> m_rightLaneLines;
-        ///@}
+        std::vector<cv::Range> m_roiRowSpans;
 
         /**
-         * @brief The distance difference that will be compared to in order to determine the direction the vehicle is moving
-         * while changing lanes.
+         * @brief The ROI bounding box of the frame downscaled to `m_scaledRoiSize`, which is reused between frames.
          */
-        double m_changingLanesPreviousDistanceDifference;
+        cv::Mat m_scaledRoiBoundingBox;
+
+        /**
+         * @brief The size of the ROI bounding box once downscaled.
+         */
+        cv::Size m_scaledRoiSize;
+
+        /**
+         * @brief The ROI bounding box of the frame in reference co-ordinates.
+         */
+        cv::Rect m_referenceRoiBoundingBox;
+
+        /**
+         * @brief The factors that map co-ordinates in the scaled ROI bounding box to the ROI bounding box at the reference
+         * resolution.
+         */
+        cv::Point2d m_roiScalingFactors;
+
+        /**
+         * @brief The geometry of the frames that the lane detector is run against.
+         */
+        FrameGeometry m_frameGeometry;
+
+        /**
+         * @brief The factor that the region-of-interest is downscaled by.
+         */
+        Globals::LaneDetectorScales m_scale;
+
+        /**
+         * @brief The edge frames of each stripe of the striped Canny algorithm, which are reused between frames.
+         */
+        std::vector<cv::Mat> m_cannyStripes;
+
+        /**
+         * @brief The hough lines detected by the front-end for the current frame, in reference co-ordinates.
+         */
+        std::vector<cv::Vec4i> m_houghLines;
+
+        /**
+         * @brief The object bounding boxes of the current frame rasterised over the ROI bounding box, so that the hough lines
+         * are checked against all of them with a lookup per end.
+         */
+        ObjectOccupancyMask m_objectOccupancyMask;
 
         /**
-         * @brief The average left, middle and right lane line lengths for the current frame.
+         * @brief Classifies the hough lines of the current frame as left, middle or right lane lines.
          */
-        ///@{
-        double m_leftLineAverageLength;
-        double m_middleLineAverageLength;
-        double m_rightLineAverageLength;
-        ///@}
+        HoughLineClassifier m_houghLineClassifier;
+
+        /**
+         * @brief The distance difference that will be compared to in order to determine the direction the vehicle is moving
+         * while changing lanes.
+         */
+        double m_changingLanesPreviousDistanceDifference;
 
         /**
          * @brief The number of frames passed since a distance difference was calculated while the vehicle is changing lanes.
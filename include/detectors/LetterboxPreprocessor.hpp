@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class LetterboxPreprocessor
+     * @brief Converts frames to the NCHW input blob of the object detector. Unlike `cv::dnn::blobFromImage`, the aspect ratio
+     * of the frame is kept by resizing it to fit within the blob and padding the remainder (letterboxing), and the blob is
+     * preallocated and reused between frames. The channel swap, scaling and change of layout are fused in to a single
+     * vectorised pass over the resized frame.
+     */
+    class LetterboxPreprocessor
+    {
+    public:
+        /**
+         * @brief Constructs a new %LetterboxPreprocessor object.
+         */
+        explicit LetterboxPreprocessor();
+
+        /**
+         * @brief Letterboxes `p_frame` in to a blob with a batch size of one.
+         *
+         * @param p_frame The `CV_8UC3` BGR frame to letterbox.
+         * @param p_blobSize The width and height of the blob.
+         */
+        void Run(const cv::Mat& p_frame, const int32_t& p_blobSize);
+
+        /**
+         * @brief Letterboxes each frame of `p_frames` in to the same blob, in the same order. The frames must all be the same
+         * size. The blob is left unchanged if there are no frames.
+         *
+         * @param p_frames The `CV_8UC3` BGR frames to letterbox.
+         * @param p_blobSize The width and height of the blob.
+         */
+        void Run(const std::vector<cv::Mat>& p_frames, const int32_t& p_blobSize);
+
+        /**
+         * @brief Get the blob of the most recently letterboxed frames.
+         *
+         * @return `const cv::Mat&` The 4D `CV_32F` blob of size [batch, 3, blob size, blob size].
+         */
+        const cv::Mat& GetBlob();
+
+        /**
+         * @brief Get the region of the blob that the most recently letterboxed frames were written to.
+         *
+         * @return `cv::Rect` The region of the blob that the frames were written to.
+         */
+        cv::Rect GetLetterbox();
+
+        /**
+         * @brief Maps a bounding box that is normalised to the blob back to the co-ordinates of the letterboxed frames.
+         *
+         * @param p_centerX The normalised x co-ordinate of the centre of the bounding box.
+         * @param p_centerY The normalised y co-ordinate of the centre of the bounding box.
+         * @param p_width The normalised width of the bounding box.
+         * @param p_height The normalised height of the bounding box.
+         * @return `cv::Rect2d` The bounding box in frame co-ordinates.
+         */
+        cv::Rect2d ToFrameBoundingBox(const float& p_centerX, const float& p_centerY, const float& p_width, const float& p_height);
+
+    private:
+        /**
+         * @brief Allocates the blob and recalculates the letterbox, refilling the blob with the padding value only if either
+         * has changed.
+         *
+         * @param p_batchSize The number of frames in the blob.
+         * @param p_blobSize The width and height of the blob.
+         * @param p_frameSize The size of the frames.
+         */
+        void Prepare(const int32_t& p_batchSize, const int32_t& p_blobSize, const cv::Size& p_frameSize);
+
+        /**
+         * @brief Resizes `p_frame` and writes it in to the letterbox of the blob at `p_batchIndex`.
+         *
+         * @param p_frame The `CV_8UC3` BGR frame to letterbox.
+         * @param p_batchIndex The index of the frame within the blob.
+         */
+        void LetterboxFrame(const cv::Mat& p_frame, const int32_t& p_batchIndex);
+
+        /**
+         * @brief The NCHW input blob, which is reused between frames.
+         */
+        cv::Mat m_blob;
+
+        /**
+         * @brief The frame resized to the letterbox, which is reused between frames.
+         */
+        cv::Mat m_resizedFrame;
+
+        /**
+         * @brief The region of the blob that the resized frame is written to.
+         */
+        cv::Rect m_letterbox;
+
+        /**
+         * @brief The factor that frame co-ordinates are multiplied by to give blob co-ordinates.
+         */
+        double m_scale;
+
+        /**
+         * @brief The width and height of the blob.
+         */
+        int32_t m_blobSize;
+    };
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/dnn/dnn.hpp>
+
+#include "helpers/Globals.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class NetworkCache
+     * @brief Keeps up to `Globals::G_NETWORK_CACHE_CAPACITY` initialised and warmed up networks, keyed by the YOLO folder,
+     * object detector type, backend and blob size, so that returning to a configuration does not read the model again. The
+     * least recently used network is evicted first. Networks can be requested from multiple threads at once.
+     */
+    class NetworkCache
+    {
+    public:
+        /**
+         * @brief A network and the format of the model it was read from, which determines how its output blobs are decoded.
+         */
+        struct Network
+        {
+            /**
+             * @brief The initialised and warmed up network.
+             */
+            cv::dnn::Net m_net;
+
+            /**
+             * @brief The format of the model that the network was read from.
+             */
+            Globals::ModelFormats m_modelFormat;
+        };
+
+        /**
+         * @brief Constructs a new %NetworkCache object.
+         */
+        explicit NetworkCache();
+
+        /**
+         * @brief Get the network for the given configuration, reading and warming it up first if it is not already cached.
+         * The model is read from the first of an ONNX model, a model bundle or the `.cfg` and `.weights` YOLO files that
+         * exists in the YOLO folder. The returned network shares its state with the cached one, so must only be run by one
+         * thread at a time.
+         *
+         * @param p_yoloFolderPath The folder containing the `.cfg` and `.weights` YOLO files.
+         * @param p_objectDetectorTypes The type of object detector, which cannot be none.
+         * @param p_objectDetectorBackEnds The backend for the network to run on.
+         * @param p_objectDetectorBlobSizes The blob size to warm the network up with.
+         * @return `Network` The warmed up network.
+         */
+        Network GetNetwork(const std::string& p_yoloFolderPath,
+                           const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
+                           const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
+                           const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
+
+        /**
+         * @brief Removes all cached networks.
+         */
+        void Clear();
+
+        /**
+         * @brief Determines whether the calibration folder within the YOLO folder contains any files, which the INT8 backend
+         * requires.
+         *
+         * @param p_yoloFolderPath The folder containing the calibration folder.
+         * @return true If the calibration folder contains any files.
+         * @return false If the calibration folder does not exist or is empty.
+         */
+        static bool HasCalibrationFrames(const std::string& p_yoloFolderPath);
+
+        /**
+         * @brief Disable constructing a new %NetworkCache object using copy constructor.
+         *
+         * @param p_networkCache The %NetworkCache to copy.
+         */
+        NetworkCache(const NetworkCache& p_networkCache) = delete;
+
+        /**
+         * @brief Disable constructing a new %NetworkCache object using move constructor.
+         *
+         * @param p_networkCache The %NetworkCache to copy.
+         */
+        NetworkCache(const NetworkCache&& p_networkCache) = delete;
+
+        /**
+         * @brief Disable constructing a new %NetworkCache object using copy assignment operator.
+         *
+         * @param p_networkCache The %NetworkCache to copy.
+         */
+        NetworkCache& operator=(const NetworkCache& p_networkCache) = delete;
+
+        /**
+         * @brief Disable constructing a new %NetworkCache object using move assignment operator.
+         *
+         * @param p_networkCache The %NetworkCache to copy.
+         */
+        NetworkCache& operator=(const NetworkCache&& p_networkCache) = delete;
+
+    private:
+        /**
+         * @brief A cached network and the configuration it was created with.
+         */
+        struct CachedNetwork
+        {
+            /**
+             * @brief The folder containing the `.cfg` and `.weights` YOLO files.
+             */
+            std::string m_yoloFolderPath;
+
+            /**
+             * @brief The initialised and warmed up network.
+             */
+            Network m_network;
+
+            /**
+             * @brief The value of `m_useCount` when the network was last requested.
+             */
+            uint64_t m_lastUsed;
+
+            /**
+             * @brief The type of object detector.
+             */
+            Globals::ObjectDetectorTypes m_objectDetectorType;
+
+            /**
+             * @brief The backend that the network runs on.
+             */
+            Globals::ObjectDetectorBackEnds m_objectDetectorBackEnd;
+
+            /**
+             * @brief The blob size that the network was warmed up with.
+             */
+            Globals::ObjectDetectorBlobSizes m_objectDetectorBlobSize;
+        };
+
+        /**
+         * @brief Find the cached network for the given configuration, marking it as the most recently used. Must be called
+         * with `m_mutex` locked.
+         *
+         * @param p_yoloFolderPath The folder containing the `.cfg` and `.weights` YOLO files.
+         * @param p_objectDetectorTypes The type of object detector.
+         * @param p_objectDetectorBackEnds The backend for the network to run on.
+         * @param p_objectDetectorBlobSizes The blob size that the network was warmed up with.
+         * @return `CachedNetwork*` The cached network or `nullptr` if it is not cached.
+         */
+        CachedNetwork* FindNetwork(const std::string& p_yoloFolderPath,
+                                   const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
+                                   const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
+                                   const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
+
+        /**
+         * @brief Read the model of the given type, set the backend to run on and run a forward pass on a blank blob of the
+         * given size, so that its layers have allocated their buffers before the first frame. ONNX models and model bundles
+         * are memory-mapped, where the mapping is only held while the model is read. For the INT8 backend, the network is
+         * quantised using the calibration frames letterboxed to the given blob size.
+         *
+         * @param p_yoloFolderPath The folder containing the `.cfg` and `.weights` YOLO files.
+         * @param p_objectDetectorTypes The type of object detector to read.
+         * @param p_objectDetectorBackEnds The backend for the network to run on.
+         * @param p_objectDetectorBlobSizes The blob size to warm the network up with.
+         * @return `Network` The warmed up network.
+         */
+        static Network LoadNetwork(const std::string& p_yoloFolderPath,
+                                   const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
+                                   const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
+                                   const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
+
+        /**
+         * @brief Letterbox evenly spaced images from the calibration folder within the YOLO folder, up to
+         * `Globals::G_OBJECT_DETECTOR_CALIBRATION_NUMBER_OF_FRAMES`, in to blobs for quantising a network. Throws
+         * `Globals::Exceptions::CalibrationDataError` if the folder does not contain any images, as this may run on the
+         * background thread of `ObjectDetector::PreloadNetwork()`.
+         *
+         * @param p_yoloFolderPath The folder containing the calibration folder.
+         * @param p_objectDetectorBlobSizes The blob size to letterbox the images to.
+         * @return `std::vector<cv::Mat>` The calibration blobs.
+         */
+        static std::vector<cv::Mat> LoadCalibrationBlobs(const std::string& p_yoloFolderPath, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
+
+        /**
+         * @brief Get the paths of the files in the calibration folder within the YOLO folder, sorted so that the same frames
+         * (and therefore the same quantisation) are used on every platform.
+         *
+         * @param p_yoloFolderPath The folder containing the calibration folder.
+         * @return `std::vector<std::filesystem::path>` The paths of the calibration frames.
+         */
+        static std::vector<std::filesystem::path> GetCalibrationFramePaths(const std::string& p_yoloFolderPath);
+
+        /**
+         * @brief The cached networks.
+         */
+        std::vector<CachedNetwork> m_cachedNetworks;
+
+        /**
+         * @brief Guards `m_cachedNetworks` and `m_useCount`.
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief The number of times a network has been requested, used to find the least recently used network.
+         */
+        uint64_t m_useCount;
+    };
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/types.hpp>
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class NonMaximaSuppression
+     * @brief Greedily keeps the highest confidence candidates that do not overlap an already kept candidate by more than a
+     * threshold, either within the same class or across all classes. The candidates are sorted once and copied in to
+     * structure-of-arrays buffers, so that each kept candidate suppresses the lower confidence candidates with a vectorised
+     * intersection-over-union.
+     */
+    class NonMaximaSuppression
+    {
+    public:
+        /**
+         * @brief Constructs a new %NonMaximaSuppression object.
+         */
+        explicit NonMaximaSuppression();
+
+        /**
+         * @brief Applies non-maxima suppression to the candidates, where the same index in each vector refers to the same
+         * candidate. Candidates with equal confidences are visited in index order (the same as `cv::dnn::NMSBoxes`).
+         *
+         * @param p_boundingBoxes The bounding boxes of the candidates.
+         * @param p_classIds The class ids of the candidates.
+         * @param p_confidences The confidences of the candidates.
+         * @param p_threshold The intersection-over-union that a candidate must be above to be suppressed.
+         * @param p_classAware Whether candidates only suppress candidates of the same class.
+         * @param p_topK The maximum number of candidates to keep, where the search stops once it is reached, or 0 to keep
+         * every candidate that is not suppressed.
+         */
+        void Run(const std::vector<cv::Rect>& p_boundingBoxes,
+                 const std::vector<uint32_t>& p_classIds,
+                 const std::vector<float>& p_confidences,
+                 const float& p_threshold,
+                 const bool& p_classAware,
+                 const uint32_t& p_topK);
+
+        /**
+         * @brief Get the indices of the candidates kept by the last call to `Run()`, in descending order of confidence.
+         *
+         * @return `const std::vector<uint32_t>&` The indices of the kept candidates.
+         */
+        const std::vector<uint32_t>& GetKeptIndices();
+
+    private:
+        /**
+         * @brief Marks the sorted candidates after `p_sortedIndex` that overlap it by more than `p_threshold` as suppressed.
+         *
+         * @param p_sortedIndex The position of the kept candidate in the sorted buffers.
+         * @param p_threshold The intersection-over-union that a candidate must be above to be suppressed.
+         * @param p_classAware Whether only candidates of the same class are suppressed.
+         */
+        void Suppress(const uint32_t& p_sortedIndex, const float& p_threshold, const bool& p_classAware);
+
+        /**
+         * @brief Whether two candidates overlap by more than a threshold, rounded in the same way as `cv::dnn::NMSBoxes` so
+         * that the same candidates are kept.
+         *
+         * @param p_lhsArea The area of the first candidate.
+         * @param p_rhsArea The area of the second candidate.
+         * @param p_intersection The area of the intersection of the candidates.
+         * @param p_threshold The intersection-over-union that the candidates must be above.
+         * @return `bool` Whether the candidates overlap by more than the threshold.
+         */
+        static bool IsOverlapping(const float& p_lhsArea, const float& p_rhsArea, const float& p_intersection, const float& p_threshold);
+
+        /**
+         * @brief The candidate indices sorted in descending order of confidence, which are reused between frames along with
+         * the sorted candidate buffers below.
+         */
+        std::vector<uint32_t> m_sortedIndices;
+
+        /**
+         * @brief The left edges of the sorted candidates.
+         */
+        std::vector<float> m_lefts;
+
+        /**
+         * @brief The top edges of the sorted candidates.
+         */
+        std::vector<float> m_tops;
+
+        /**
+         * @brief The right edges (exclusive) of the sorted candidates.
+         */
+        std::vector<float> m_rights;
+
+        /**
+         * @brief The bottom edges (exclusive) of the sorted candidates.
+         */
+        std::vector<float> m_bottoms;
+
+        /**
+         * @brief The areas of the sorted candidates. The edges and areas are integers well below the largest that a float
+         * holds exactly, so the intersections and unions are exact.
+         */
+        std::vector<float> m_areas;
+
+        /**
+         * @brief The class ids of the sorted candidates, stored as floats so that they are compared in the same registers as
+         * the bounding boxes. Class ids are far below the largest integer that a float holds exactly.
+         */
+        std::vector<float> m_classIds;
+
+        /**
+         * @brief Whether each sorted candidate has been suppressed, as all bits set or clear so that it can be combined with
+         * vector comparison masks.
+         */
+        std::vector<uint32_t> m_suppressed;
+
+        /**
+         * @brief The indices of the kept candidates.
+         */
+        std::vector<uint32_t> m_keptIndices;
+    };
+}
@@ -1,12 +1,21 @@
 #pragma once
 
 #include <cstdint>
+#include <future>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
 #include <opencv2/dnn/dnn.hpp>
 
+#include "detectors/LetterboxPreprocessor.hpp"
+#include "detectors/NetworkCache.hpp"
+#include "detectors/NonMaximaSuppression.hpp"
+#include "detectors/ObjectTracker.hpp"
+#include "detectors/YoloOutputDecoder.hpp"
+#include "helpers/FrameGeometry.hpp"
 #include "helpers/Globals.hpp"
 #include "helpers/Information.hpp"
 
@@ -29,7 +38,8 @@ namespace LaneAndObjectDetection
         explicit ObjectDetector();
 
         /**
-         * @brief Set the properties of the %ObjectDetector object.
+         * @brief Set the properties of the %ObjectDetector object. Throws `Globals::Exceptions::CalibrationDataError` if the
+         * INT8 backend is requested without any calibration frames.
          *
          * @param p_yoloFolderPath The folder containing the `.cfg` and `.weights` YOLO files.
          * @param p_objectDetectorTypes The type of object detector to use with an option to disable object detection. The tiny
@@ -46,43 +56,292 @@ namespace LaneAndObjectDetection
                            const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
 
         /**
-         * @brief Run the object detector against `p_frame`.
+         * @brief Set how often the object detector is run by `RunObjectDetector(const cv::Mat&)`. On the frames in between,
+         * the objects from the last detection are propagated by the object tracker instead.
+         *
+         * @param p_detectionInterval The number of frames between each detection, where 1 detects every frame and
+         * `Globals::G_OBJECT_DETECTOR_ADAPTIVE_INTERVAL` adapts the interval to how well the tracker predicts the detections.
+         */
+        void SetDetectionInterval(const uint32_t& p_detectionInterval);
+
+        /**
+         * @brief Get how often the object detector is run, see `SetDetectionInterval()`.
+         *
+         * @return `uint32_t` The number of frames between each detection.
+         */
+        uint32_t GetDetectionInterval();
+
+        /**
+         * @brief Set whether `RunObjectDetector(const cv::Mat&)` also runs the network on a crop around the horizon, where
+         * distant vehicles are too small to be detected in the full frame at the lower blob sizes. The detections of both
+         * passes are merged with non-maxima suppression. This costs a second forward pass at the same blob size, which at 416
+         * and below is still cheaper than a single pass at 608.
+         *
+         * @param p_horizonCrop Whether to run the object detector on the horizon crop.
+         */
+        void SetHorizonCrop(const bool& p_horizonCrop);
+
+        /**
+         * @brief Get whether the object detector also runs on a crop around the horizon, see `SetHorizonCrop()`.
+         *
+         * @return true If the horizon crop is enabled.
+         * @return false If the horizon crop is disabled.
+         */
+        bool IsHorizonCropEnabled();
+
+        /**
+         * @brief Start loading the network for the given type and blob size on a background thread, followed by a forward pass
+         * to warm it up, so that `SwitchNetwork()` can later switch to it without stalling. Networks that are already cached
+         * are ready immediately. Only one network is preloaded at a
+         * time and a network that is still loading is never replaced.
+         *
+         * @param p_objectDetectorTypes The type of object detector to preload, which cannot be none.
+         * @param p_objectDetectorBlobSizes The blob size to warm the network up with.
+         */
+        void PreloadNetwork(const Globals::ObjectDetectorTypes& p_objectDetectorTypes, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
+
+        /**
+         * @brief Switch to the network for the given type and blob size if it has been preloaded, otherwise start preloading
+         * it and keep running the current network. Any exception thrown while preloading the network, such as
+         * `Globals::Exceptions::CalibrationDataError`, is rethrown here.
+         *
+         * @param p_objectDetectorTypes The type of object detector to switch to, which cannot be none.
+         * @param p_objectDetectorBlobSizes The blob size to switch to.
+         * @return true If the object detector is now running with the given type and blob size.
+         * @return false If the network is still loading or object detection is disabled.
+         */
+        bool SwitchNetwork(const Globals::ObjectDetectorTypes& p_objectDetectorTypes, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
+
+        /**
+         * @brief Run the object detector against `p_frame`, or propagate the tracked objects if the detection interval has not
+         * yet elapsed.
          *
          * @param p_frame The frame to run the object detector against.
          */
         void RunObjectDetector(const cv::Mat& p_frame);
 
         /**
-         * @brief Get the ObjectDetectionInformation struct.
+         * @brief Run the object detector against a batch of frames using a single forward pass, which makes better use of the
+         * CPU caches and threads of the DNN backend than running each frame individually. The information of the last frame
+         * is also returned by `GetInformation()`. Every frame is detected regardless of the detection interval, and the horizon
+         * crop is not used.
+         *
+         * @param p_frames The frames to run the object detector against.
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct of each frame in `p_frames`, in the same
+         * order.
+         */
+        void RunObjectDetector(const std::vector<cv::Mat>& p_frames, std::vector<ObjectDetectionInformation>& p_objectDetectionInformation);
+
+        /**
+         * @brief Filters the rows of the output blobs of a single frame by confidence and applies non-maxima suppression. All
+         * intermediate buffers are reused between calls so that no heap allocations are made once warmed up. This is public
+         * so that it can be run against synthetic output blobs by the performance tests.
+         *
+         * @param p_outputBlobs The output blobs of the unconnected output layers for a single frame.
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct to store the detected objects in.
+         */
+        void DecodeOutputBlobs(const std::vector<cv::Mat>& p_outputBlobs, ObjectDetectionInformation& p_objectDetectionInformation);
+
+        /**
+         * @brief Get the ObjectDetectionInformation struct without copying it. The reference is only valid until the object
+         * detector is next run.
          *
-         * @return ObjectDetectionInformation The ObjectDetectionInformation struct.
+         * @return `const ObjectDetectionInformation&` The ObjectDetectionInformation struct.
          */
-        ObjectDetectionInformation GetInformation();
+        const ObjectDetectionInformation& GetInformation();
+
+        /**
+         * @brief Get an immutable snapshot of the ObjectDetectionInformation struct which can be safely handed to other
+         * threads without copying it. The object detector never writes to a snapshot that is still held, instead it copies on
+         * write.
+         *
+         * @return `std::shared_ptr<const ObjectDetectionInformation>` The ObjectDetectionInformation struct.
+         */
+        std::shared_ptr<const ObjectDetectionInformation> GetInformationSnapshot();
 
     private:
+        /**
+         * @brief Decodes the rows of the output blobs with a confidence above the threshold in to frame-space candidates,
+         * appending those not on the hood of the car to the initial object vectors.
+         *
+         * @param p_outputBlobs The output blobs of the unconnected output layers for a single frame.
+         * @param p_letterboxPreprocessor The preprocessor that letterboxed `p_region` in to the blob.
+         * @param p_region The region of the frame that was letterboxed. Candidates within
+         * `Globals::G_OBJECT_DETECTOR_HORIZON_CROP_BORDER` pixels of an edge of the region that is inside the frame are
+         * discarded as they are cut off.
+         */
+        void AppendCandidates(const std::vector<cv::Mat>& p_outputBlobs, LetterboxPreprocessor& p_letterboxPreprocessor, const cv::Rect& p_region);
+
+        /**
+         * @brief Applies non-maxima suppression to the initial object vectors and stores the kept candidates.
+         *
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct to store the detected objects in.
+         */
+        void SelectObjects(ObjectDetectionInformation& p_objectDetectionInformation);
+
+        /**
+         * @brief Update the frame geometry if the frames passed to the object detector have changed size.
+         *
+         * @param p_frameSize The size of the frames passed to the object detector.
+         */
+        void UpdateFrameGeometry(const cv::Size& p_frameSize);
+
+        /**
+         * @brief Get the horizon crop for the current frame size, see `Globals::G_OBJECT_DETECTOR_HORIZON_CROP_SIZE`.
+         *
+         * @return `cv::Rect` The region of the frame to run the second pass on.
+         */
+        cv::Rect GetHorizonCrop();
+
+        /**
+         * @brief Get the ObjectDetectionInformation struct to write the next frame to. If a snapshot of the current one is
+         * still held, it is replaced with an empty struct from the pool that is no longer held.
+         *
+         * @return `ObjectDetectionInformation&` The ObjectDetectionInformation struct to write to.
+         */
+        ObjectDetectionInformation& GetWritableInformation();
+
         /**
          * @brief OpenCV object which allows the use of pre-trained neural networks.
          */
         cv::dnn::Net m_net;
 
+        /**
+         * @brief The networks that have been loaded, so that returning to a configuration does not load it again.
+         */
+        NetworkCache m_networkCache;
+
+        /**
+         * @brief The network being loaded in to `m_networkCache` on a background thread by `PreloadNetwork()`, if any. This
+         * is declared after the cache so that it is destroyed (which waits for the load to finish) first.
+         */
+        std::future<NetworkCache::Network> m_preloadedNet;
+
+        /**
+         * @brief The folder containing the `.cfg` and `.weights` YOLO files.
+         */
+        std::string m_yoloFolderPath;
+
         /**
          * @brief The ObjectDetectionInformation struct containing all object detection-related information.
          */
-        ObjectDetectionInformation m_objectDetectionInformation;
+        std::shared_ptr<ObjectDetectionInformation> m_objectDetectionInformation;
+
+        /**
+         * @brief ObjectDetectionInformation structs that were replaced while a snapshot of them was held, which are reused by
+         * `GetWritableInformation()` once they have been released.
+         */
+        std::vector<std::shared_ptr<ObjectDetectionInformation>> m_objectDetectionInformationPool;
+
+        /**
+         * @brief Decodes the output blobs into candidate detections.
+         */
+        YoloOutputDecoder m_yoloOutputDecoder;
+
+        /**
+         * @brief Letterboxes the frames in to the input blob passed to the network, which is reused between frames.
+         */
+        LetterboxPreprocessor m_letterboxPreprocessor;
+
+        /**
+         * @brief Letterboxes the horizon crop in to its own input blob, so that the letterbox of the full frame is kept for
+         * mapping its candidates back to the frame.
+         */
+        LetterboxPreprocessor m_horizonCropPreprocessor;
+
+        /**
+         * @brief The output blobs of the unconnected output layers.
+         */
+        std::vector<cv::Mat> m_outputBlobs;
+
+        /**
+         * @brief The output blobs of a single frame within a batch.
+         */
+        std::vector<cv::Mat> m_frameOutputBlobs;
+
+        /**
+         * @brief The class ids of the candidates that are not on the hood of the car.
+         */
+        std::vector<uint32_t> m_initialObjectClassIds;
+
+        /**
+         * @brief The frame-space bounding boxes of the candidates that are not on the hood of the car.
+         */
+        std::vector<cv::Rect> m_initialObjectBoundingBoxes;
+
+        /**
+         * @brief The confidences of the candidates that are not on the hood of the car.
+         */
+        std::vector<float> m_initialObjectConfidences;
+
+        /**
+         * @brief Suppresses the candidates that overlap a higher confidence candidate.
+         */
+        NonMaximaSuppression m_nonMaximaSuppression;
 
         /**
          * @brief The names of layers with unconnected outputs.
          */
         std::vector<std::string> m_unconnectedOutputLayerNames;
 
+        /**
+         * @brief Propagates the detected objects across the frames between detections.
+         */
+        ObjectTracker m_objectTracker;
+
+        /**
+         * @brief The geometry of the frames most recently passed to the object detector.
+         */
+        FrameGeometry m_frameGeometry;
+
+        /**
+         * @brief The requested number of frames between each detection, or `Globals::G_OBJECT_DETECTOR_ADAPTIVE_INTERVAL`.
+         */
+        uint32_t m_detectionInterval;
+
+        /**
+         * @brief The number of frames between each detection currently in use, which only changes when adaptive.
+         */
+        uint32_t m_currentDetectionInterval;
+
+        /**
+         * @brief The number of frames left to propagate with the object tracker before the next detection.
+         */
+        uint32_t m_framesUntilDetection;
+
         /**
          * @brief The spatial size for the output image used by the `cv::dnn::blobFromImage` function.
          */
         int32_t m_blobSize;
 
+        /**
+         * @brief The type of object detector currently in use.
+         */
+        Globals::ObjectDetectorTypes m_objectDetectorType;
+
+        /**
+         * @brief The backend that the networks run on.
+         */
+        Globals::ObjectDetectorBackEnds m_objectDetectorBackEnd;
+
+        /**
+         * @brief The type of object detector of `m_preloadedNet`.
+         */
+        Globals::ObjectDetectorTypes m_preloadedObjectDetectorType;
+
+        /**
+         * @brief The blob size that `m_preloadedNet` is warmed up with.
+         */
+        Globals::ObjectDetectorBlobSizes m_preloadedBlobSize;
+
         /**
          * @brief Whether to skip object detection.
          */
         bool m_skipObjectDetection;
+
+        /**
+         * @brief Whether to also run the object detector on the horizon crop.
+         */
+        bool m_horizonCrop;
     };
 }
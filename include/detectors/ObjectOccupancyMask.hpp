@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "helpers/FrameGeometry.hpp"
+#include "helpers/Information.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class ObjectOccupancyMask
+     * @brief A mask over a region in reference co-ordinates where every point covered by an object bounding box is set, so
+     * that whether a point is within any of the bounding boxes is a single lookup rather than a test against each of them.
+     * Only the parts of the mask set for the previous frame are cleared when it is updated.
+     */
+    class ObjectOccupancyMask
+    {
+    public:
+        /**
+         * @brief Constructs a new %ObjectOccupancyMask object.
+         */
+        explicit ObjectOccupancyMask();
+
+        /**
+         * @brief Set the region that the mask covers, which clears the mask.
+         *
+         * @param p_region The region in reference co-ordinates. Points on its right and bottom edges are also covered.
+         */
+        void SetRegion(const cv::Rect& p_region);
+
+        /**
+         * @brief Sets the mask to the object bounding boxes of the current frame.
+         *
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing the object bounding boxes, in
+         * frame co-ordinates.
+         * @param p_frameGeometry The geometry of the frame, which maps the bounding boxes to reference co-ordinates.
+         */
+        void Update(const ObjectDetectionInformation& p_objectDetectionInformation, const FrameGeometry& p_frameGeometry);
+
+        /**
+         * @brief Determines whether `p_point` is within any of the object bounding boxes, including their edges.
+         *
+         * @param p_point The point to check, in reference co-ordinates.
+         * @return true If `p_point` is within any of the object bounding boxes.
+         * @return false If `p_point` is NOT within any of the object bounding boxes.
+         */
+        bool IsOccupied(const cv::Point& p_point);
+
+    private:
+        /**
+         * @brief The mask over `m_region`, where points within an object bounding box are non-zero.
+         */
+        cv::Mat m_mask;
+
+        /**
+         * @brief The region that the mask covers, in reference co-ordinates.
+         */
+        cv::Rect m_region;
+
+        /**
+         * @brief The parts of the mask set by the last call to `Update()`, which are cleared by the next.
+         */
+        std::vector<cv::Rect> m_setRegions;
+
+        /**
+         * @brief The object bounding boxes of the current frame in reference co-ordinates, where the bottom right corner is
+         * inside the bounding box, for points outside of the mask.
+         */
+        std::vector<cv::Rect> m_boundingBoxes;
+    };
+}
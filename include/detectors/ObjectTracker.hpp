@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/matx.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Information.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class ObjectTracker
+     * @brief Propagates the detected objects across the frames that the object detector does not run on. Detections are
+     * associated with the existing tracks by class and intersection-over-union, and each track moves with a constant
+     * velocity (of both its position and size) which is smoothed over successive detections.
+     */
+    class ObjectTracker
+    {
+    public:
+        /**
+         * @brief Constructs a new %ObjectTracker object.
+         */
+        explicit ObjectTracker();
+
+        /**
+         * @brief Corrects the tracks with the objects detected for the current frame. Detections which are not associated with
+         * a track start a new track, while tracks which are not associated with a detection are removed.
+         *
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing the detected objects.
+         * @return `double` How well the tracks predicted the detections, between 0 (no detection was predicted) and 1 (every
+         * detection was predicted exactly and no track was lost).
+         */
+        double Update(const ObjectDetectionInformation& p_objectDetectionInformation);
+
+        /**
+         * @brief Advances every track by one frame and stores them in `p_objectDetectionInformation`.
+         *
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct to store the tracked objects in.
+         */
+        void Predict(ObjectDetectionInformation& p_objectDetectionInformation);
+
+        /**
+         * @brief Removes all tracks.
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief The state of a single tracked object.
+         */
+        struct Track
+        {
+            /**
+             * @brief The predicted bounding box of the object for the current frame.
+             */
+            cv::Rect2d m_boundingBox;
+
+            /**
+             * @brief The bounding box of the object when it was last detected.
+             */
+            cv::Rect2d m_detectedBoundingBox;
+
+            /**
+             * @brief The change in the x, y, width and height of the bounding box per frame.
+             */
+            cv::Vec4d m_velocity;
+
+            /**
+             * @brief The bounding box colour.
+             */
+            cv::Scalar m_boundingBoxColour;
+
+            /**
+             * @brief The index of the object within `Globals::G_OBJECT_DETECTOR_OBJECT_NAMES`.
+             */
+            uint32_t m_classId;
+
+            /**
+             * @brief The confidence of the last detection.
+             */
+            float m_confidence;
+
+            /**
+             * @brief The number of frames since the object was last detected.
+             */
+            uint32_t m_framesSinceDetection;
+        };
+
+        /**
+         * @brief Moves `p_track` forward by one frame.
+         *
+         * @param p_track The track to move.
+         */
+        static void Advance(Track& p_track);
+
+        /**
+         * @brief Get the intersection-over-union of `p_lhs` and `p_rhs`.
+         *
+         * @param p_lhs The first bounding box.
+         * @param p_rhs The second bounding box.
+         * @return `double` The intersection-over-union, which is 0 if neither bounding box has an area.
+         */
+        static double IntersectionOverUnion(const cv::Rect2d& p_lhs, const cv::Rect2d& p_rhs);
+
+        /**
+         * @brief The current tracks.
+         */
+        std::vector<Track> m_tracks;
+
+        /**
+         * @brief The tracks being built by `Update()`, which are swapped with `m_tracks` to avoid reallocating.
+         */
+        std::vector<Track> m_updatedTracks;
+
+        /**
+         * @brief Whether each of `m_tracks` has been associated with a detection by `Update()`.
+         */
+        std::vector<uint8_t> m_trackAssociated;
+    };
+}
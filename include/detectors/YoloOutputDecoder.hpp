@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/mat.hpp>
+
+#include "helpers/Globals.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class YoloOutputDecoder
+     * @brief Decodes the rows of the YOLO output blobs into candidate detections. Rows are first rejected on their objectness
+     * score, as OpenCV scales the class scores by it, before a vectorised argmax is taken over the class scores of the
+     * remaining rows. Candidates are stored in structure-of-arrays buffers.
+     */
+    class YoloOutputDecoder
+    {
+    public:
+        /**
+         * @brief The candidate detections decoded from the output blobs, where the same index in each buffer refers to the
+         * same candidate. Co-ordinates are normalised to between 0 and 1.
+         */
+        struct Candidates
+        {
+            /**
+             * @brief The index of the class with the highest score.
+             */
+            std::vector<uint32_t> m_classIds;
+
+            /**
+             * @brief The highest class score.
+             */
+            std::vector<float> m_confidences;
+
+            /**
+             * @brief The x co-ordinate of the centre of the bounding box.
+             */
+            std::vector<float> m_centerX;
+
+            /**
+             * @brief The y co-ordinate of the centre of the bounding box.
+             */
+            std::vector<float> m_centerY;
+
+            /**
+             * @brief The width of the bounding box.
+             */
+            std::vector<float> m_widths;
+
+            /**
+             * @brief The height of the bounding box.
+             */
+            std::vector<float> m_heights;
+        };
+
+        /**
+         * @brief Constructs a new %YoloOutputDecoder object.
+         */
+        explicit YoloOutputDecoder();
+
+        /**
+         * @brief Removes all candidates while keeping the capacity of the buffers.
+         */
+        void Clear();
+
+        /**
+         * @brief Set the format of the model that the output blobs come from. The candidates of every format are decoded in
+         * to the same normalised co-ordinates and class scores multiplied by the objectness score.
+         *
+         * @param p_modelFormat The format of the model.
+         * @param p_blobSize The spatial size of the input blob, which ONNX models output their bounding boxes relative to.
+         */
+        void SetModelFormat(const Globals::ModelFormats& p_modelFormat, const int32_t& p_blobSize);
+
+        /**
+         * @brief Appends the candidates within `p_outputBlob` whose highest class score is above `p_confidenceThreshold`.
+         *
+         * @param p_outputBlob A 2D `CV_32F` output blob (or 3D with a batch size of one) where each row is structured as the
+         * following [cx, cy, w, h, objectness, class 1 score, class 2 score, ..., class n score].
+         * @param p_confidenceThreshold The class score that a candidate must be above.
+         */
+        void Decode(const cv::Mat& p_outputBlob, const float& p_confidenceThreshold);
+
+        /**
+         * @brief Get the candidates decoded since the last call to `Clear()`.
+         *
+         * @return `const Candidates&` The candidates decoded since the last call to `Clear()`.
+         */
+        const Candidates& GetCandidates();
+
+        /**
+         * @brief Get the index and value of the highest score, returning the first index if the highest score occurs more than
+         * once (the same as `cv::minMaxLoc`).
+         *
+         * @param p_scores The scores to search.
+         * @param p_numberOfScores The number of scores to search.
+         * @param p_maxScore The highest score.
+         * @return `int32_t` The index of the highest score.
+         */
+        static int32_t ArgMax(const float* p_scores, const int32_t& p_numberOfScores, float& p_maxScore);
+
+    private:
+        /**
+         * @brief The candidates decoded since the last call to `Clear()`, which are reused between frames.
+         */
+        Candidates m_candidates;
+
+        /**
+         * @brief The factor that the bounding boxes are multiplied by to normalise them.
+         */
+        float m_boundingBoxScale;
+
+        /**
+         * @brief Whether the class scores have already been multiplied by the objectness score.
+         */
+        bool m_scoresIncludeObjectness;
+    };
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class BoundedQueue
+     * @brief A thread-safe first-in-first-out queue with a fixed capacity which is used to connect the stages of the
+     * processing pipeline. Producers block while the queue is full and consumers block while the queue is empty.
+     * @tparam T The type of item to be stored in the queue.
+     */
+    template<typename T>
+    class BoundedQueue
+    {
+    public:
+        /**
+         * @brief Constructs a new %BoundedQueue object.
+         *
+         * @param p_capacity The maximum number of items that can be held in the queue at once.
+         */
+        explicit BoundedQueue(const uint32_t& p_capacity) :
+            m_capacity(p_capacity),
+            m_closed(false)
+        {}
+
+        /**
+         * @brief Adds `p_item` to the back of the queue, blocking while the queue is full.
+         *
+         * @param p_item The item to add to the queue.
+         * @return true If `p_item` was added to the queue.
+         * @return false If the queue was closed and `p_item` was discarded.
+         */
+        bool Push(T p_item)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_notFull.wait(lock, [this] { return m_closed || m_items.size() < m_capacity; });
+
+            if (m_closed)
+            {
+                return false;
+            }
+
+            m_items.push_back(std::move(p_item));
+            m_notEmpty.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief Removes the item at the front of the queue, blocking while the queue is empty.
+         *
+         * @return `std::optional<T>` The item at the front of the queue or `std::nullopt` if the queue has been closed and
+         * all remaining items have been removed.
+         */
+        std::optional<T> Pop()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_notEmpty.wait(lock, [this] { return m_closed || !m_items.empty(); });
+
+            if (m_items.empty())
+            {
+                return std::nullopt;
+            }
+
+            std::optional<T> item(std::move(m_items.front()));
+            m_items.pop_front();
+            m_notFull.notify_one();
+            return item;
+        }
+
+        /**
+         * @brief Closes the queue. Any blocked producers and consumers are woken, future pushes are rejected and pops will
+         * drain the remaining items before returning `std::nullopt`.
+         */
+        void Close()
+        {
+            const std::lock_guard<std::mutex> LOCK(m_mutex);
+            m_closed = true;
+            m_notFull.notify_all();
+            m_notEmpty.notify_all();
+        }
+
+        /**
+         * @brief Get the number of items currently held in the queue.
+         *
+         * @return `uint32_t` The number of items currently held in the queue.
+         */
+        uint32_t GetSize()
+        {
+            const std::lock_guard<std::mutex> LOCK(m_mutex);
+            return static_cast<uint32_t>(m_items.size());
+        }
+
+    private:
+        /**
+         * @brief The items currently held in the queue.
+         */
+        std::deque<T> m_items;
+
+        /**
+         * @brief Guards all member variables.
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief Signalled when an item has been removed from the queue or the queue has been closed.
+         */
+        std::condition_variable m_notFull;
+
+        /**
+         * @brief Signalled when an item has been added to the queue or the queue has been closed.
+         */
+        std::condition_variable m_notEmpty;
+
+        /**
+         * @brief The maximum number of items that can be held in the queue at once.
+         */
+        uint32_t m_capacity;
+
+        /**
+         * @brief Whether the queue has been closed.
+         */
+        bool m_closed;
+    };
+}
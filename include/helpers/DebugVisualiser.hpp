@@ -0,0 +1,63 @@
+#pragma once
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Information.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class DebugVisualiser
+     * @brief Renders and displays the lane detector debug frames. The hough lines frame is drawn from the trace of classified
+     * hough lines recorded by the lane detector, directly at the debugging frame size, so nothing is rendered unless the debug
+     * windows are open.
+     */
+    class DebugVisualiser
+    {
+    public:
+        /**
+         * @brief Constructs a new %DebugVisualiser object.
+         */
+        explicit DebugVisualiser();
+
+        /**
+         * @brief Renders the debug frames of the current frame and displays them in the debug windows.
+         *
+         * @param p_laneDetectionInformation The LaneDetectionInformation struct containing the ROI and Canny frames and the
+         * classified hough lines.
+         */
+        void Show(const LaneDetectionInformation& p_laneDetectionInformation);
+
+        /**
+         * @brief Closes the debug windows.
+         */
+        static void Close();
+
+    private:
+        /**
+         * @brief Draws the classified hough lines on to `m_houghLinesFrame`, coloured by their type.
+         *
+         * @param p_laneDetectionInformation The LaneDetectionInformation struct containing the classified hough lines.
+         */
+        void DrawHoughLines(const LaneDetectionInformation& p_laneDetectionInformation);
+
+        /**
+         * @brief The size of the debug frames.
+         */
+        cv::Size m_debuggingFrameSize;
+
+        /**
+         * @brief The debug frames, which keep their allocation between frames.
+         */
+        ///@{
+        cv::Mat m_roiFrame;
+        cv::Mat m_cannyFrame;
+        cv::Mat m_houghLinesFrame;
+        ///@}
+    };
+}
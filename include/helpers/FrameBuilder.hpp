@@ -5,6 +5,7 @@
 #include <opencv2/core/mat.hpp>
 #include <opencv2/core/types.hpp>
 
+#include "helpers/FrameGeometry.hpp"
 #include "helpers/Globals.hpp"
 #include "helpers/Information.hpp"
 
@@ -61,18 +62,20 @@ namespace LaneAndObjectDetection
          * @param p_frame The frame to update.
          * @param p_laneDetectionInformation The information needed by %FrameBuilder to update frame with lane detection
          * information.
+         * @param p_frameGeometry The geometry of `p_frame` containing the UI locations.
          * @param p_debugMode Whether in debug mode.
          */
-        static void AddLaneDetectorInformation(cv::Mat& p_frame, const LaneDetectionInformation& p_laneDetectionInformation, const bool& p_debugMode);
+        static void AddLaneDetectorInformation(cv::Mat& p_frame, const LaneDetectionInformation& p_laneDetectionInformation, const FrameGeometry& p_frameGeometry, const bool& p_debugMode);
 
         /**
          * @brief Adds performance information to `p_frame`.
          *
          * @param p_frame The frame to update.
          * @param p_performanceInformation The information needed by %FrameBuilder to update frame with performance information.
+         * @param p_frameGeometry The geometry of `p_frame` containing the UI locations.
          * @param p_debugMode Whether in debug mode.
          */
-        static void AddPerformanceInformation(cv::Mat& p_frame, const PerformanceInformation& p_performanceInformation, const bool& p_debugMode);
+        static void AddPerformanceInformation(cv::Mat& p_frame, const PerformanceInformation& p_performanceInformation, const FrameGeometry& p_frameGeometry, const bool& p_debugMode);
 
         /**
          * @brief Adds video manager information to `p_frame`.
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Globals.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @brief The geometry of the input frames, derived from their actual resolution when the input is opened.
+     *
+     * The geometry constants in Globals are defined at the reference resolution of `Globals::G_VIDEO_INPUT_WIDTH` x
+     * `Globals::G_VIDEO_INPUT_HEIGHT`. The region-of-interest is scaled with the frame, while the UI stays the same size in
+     * pixels and is anchored to the bottom of the frame (and the right of the frame for elements on the right-hand side).
+     */
+    struct FrameGeometry
+    {
+        /**
+         * @brief Constructs a new %FrameGeometry object at the reference resolution.
+         */
+        explicit FrameGeometry();
+
+        /**
+         * @brief Constructs a new %FrameGeometry object for frames of `p_frameSize`.
+         *
+         * @param p_frameSize The resolution of the input frames.
+         */
+        explicit FrameGeometry(const cv::Size& p_frameSize);
+
+        /**
+         * @brief Maps a point from frame co-ordinates to reference resolution co-ordinates.
+         *
+         * @param p_point The point in frame co-ordinates.
+         * @return `cv::Point` The point in reference resolution co-ordinates.
+         */
+        cv::Point ToReference(const cv::Point& p_point) const;
+
+        /**
+         * @brief Maps a point from reference resolution co-ordinates to frame co-ordinates.
+         *
+         * @param p_point The point in reference resolution co-ordinates.
+         * @return `cv::Point` The point in frame co-ordinates.
+         */
+        cv::Point FromReference(const cv::Point& p_point) const;
+
+        /**
+         * @brief The resolution of the input frames.
+         */
+        cv::Size m_frameSize;
+
+        /**
+         * @brief The factors that map reference resolution co-ordinates to frame co-ordinates.
+         */
+        cv::Point2d m_scalingFactors;
+
+        /**
+         * @brief The bounding box of the region-of-interest in frame co-ordinates.
+         */
+        cv::Rect m_roiBoundingBox;
+
+        /**
+         * @brief The UI locations in frame co-ordinates, see the `Globals::G_UI_RECT_*` and `Globals::G_UI_POINT_*` constants.
+         */
+        ///@{
+        cv::Rect m_uiRectTimestamp;
+        cv::Rect m_uiRectFps;
+        cv::Rect m_uiRectFrameReader;
+        cv::Rect m_uiRectDrivingState;
+        cv::Rect m_uiRectDrivingStateSubtitle;
+        cv::Rect m_uiRectDebugModeStatus;
+        cv::Rect m_uiRectRecordingStatus;
+        cv::Rect m_uiRectRecordingElapsedTime;
+        cv::Point m_uiPointRecordingDot;
+        cv::Rect m_uiRectNotRecordingStatus;
+        ///@}
+    };
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <opencv2/videoio.hpp>
+
+#include "helpers/Globals.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class FrameReader
+     * @brief Decodes the input video stream on a dedicated thread into a preallocated ring buffer of frames so that decode
+     * latency and camera jitter are not charged to the frames being processed.
+     */
+    class FrameReader
+    {
+    public:
+        /**
+         * @brief Constructs a new %FrameReader object.
+         */
+        explicit FrameReader();
+
+        /**
+         * @brief Destructs a %FrameReader object.
+         */
+        ~FrameReader();
+
+        /**
+         * @brief Opens the video capturing device and preallocates the ring buffer. The capture thread is started by the first
+         * call to `Read()`.
+         *
+         * @param p_inputVideoCamera Camera ID of the video capturing device to open using the OpenCV `VideoCapture` class.
+         * @return true If the video capturing device was opened.
+         * @return false If the video capturing device could not be opened.
+         */
+        bool Open(const int32_t& p_inputVideoCamera);
+
+        /**
+         * @brief Opens the video file and preallocates the ring buffer. The capture thread is started by the first call to
+         * `Read()`.
+         *
+         * @param p_inputVideoFilePath The file path of the video file to open using the OpenCV `VideoCapture` class.
+         * @return true If the video file was opened.
+         * @return false If the video file could not be opened.
+         */
+        bool Open(const std::string& p_inputVideoFilePath);
+
+        /**
+         * @brief Set what the capture thread does when the ring buffer is full.
+         *
+         * @param p_frameReaderPolicy `BLOCK` waits for a free buffer so that no frames are lost (suited to video files) while
+         * `DROP_OLDEST` overwrites the oldest decoded frame so that the newest frame is always available (suited to live
+         * cameras).
+         */
+        void SetPolicy(const Globals::FrameReaderPolicies& p_frameReaderPolicy);
+
+        /**
+         * @brief Gets the oldest decoded frame, blocking until one is available. The buffers of `p_frame` and the ring buffer
+         * are swapped so that no pixel data is copied, and the capture thread decodes in to the buffer that `p_frame` held.
+         *
+         * @param p_frame The frame to store the decoded frame in. This should be a previously read frame that is no longer
+         * needed so that the capture thread reuses its buffer rather than allocating a new one.
+         * @return true If a frame was read.
+         * @return false If the end of the input video stream has been reached or the %FrameReader has been released.
+         */
+        bool Read(cv::Mat& p_frame);
+
+        /**
+         * @brief Stops the capture thread and releases the input video stream.
+         */
+        void Release();
+
+        /**
+         * @brief Get the resolution of the input video stream. If the capture backend cannot report it, the capture thread is
+         * started and this blocks until the first frame has been decoded.
+         *
+         * @return `cv::Size` The resolution of the input video stream, or an empty size if no frame could be decoded.
+         */
+        cv::Size GetFrameSize();
+
+        /**
+         * @brief Get the number of decoded frames waiting in the ring buffer.
+         *
+         * @return `uint32_t` The number of decoded frames waiting in the ring buffer.
+         */
+        uint32_t GetQueueDepth();
+
+        /**
+         * @brief Get the number of decoded frames that have been overwritten before being read when using the `DROP_OLDEST`
+         * policy.
+         *
+         * @return `uint32_t` The number of dropped frames since the input video stream was opened.
+         */
+        uint32_t GetDroppedFrames();
+
+        /**
+         * @brief Disable constructing a new %FrameReader object using copy constructor.
+         *
+         * @param p_frameReader The %FrameReader to copy.
+         */
+        FrameReader(const FrameReader& p_frameReader) = delete;
+
+        /**
+         * @brief Disable constructing a new %FrameReader object using move constructor.
+         *
+         * @param p_frameReader The %FrameReader to copy.
+         */
+        FrameReader(const FrameReader&& p_frameReader) = delete;
+
+        /**
+         * @brief Disable constructing a new %FrameReader object using copy assignment operator.
+         *
+         * @param p_frameReader The %FrameReader to copy.
+         */
+        FrameReader& operator=(const FrameReader& p_frameReader) = delete;
+
+        /**
+         * @brief Disable constructing a new %FrameReader object using move assignment operator.
+         *
+         * @param p_frameReader The %FrameReader to copy.
+         */
+        FrameReader& operator=(const FrameReader&& p_frameReader) = delete;
+
+    private:
+        /**
+         * @brief Queries the input video stream resolution, preallocates the ring buffer and resets all counters.
+         */
+        void InitialiseRingBuffer();
+
+        /**
+         * @brief The capture thread main loop which decodes frames in to the ring buffer until the end of the input video
+         * stream is reached or the %FrameReader is released.
+         */
+        void CaptureFrames();
+
+        /**
+         * @brief Represents the input video stream.
+         */
+        cv::VideoCapture m_inputVideo;
+
+        /**
+         * @brief The preallocated ring buffer of decoded frames.
+         */
+        std::vector<cv::Mat> m_ringBuffer;
+
+        /**
+         * @brief The thread decoding frames in to the ring buffer.
+         */
+        std::thread m_captureThread;
+
+        /**
+         * @brief Guards the ring buffer indices, counters and flags.
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief Signalled when a frame has been read from the ring buffer or the %FrameReader has been released.
+         */
+        std::condition_variable m_frameRead;
+
+        /**
+         * @brief Signalled when a frame has been decoded in to the ring buffer or the capture thread has finished.
+         */
+        std::condition_variable m_frameDecoded;
+
+        /**
+         * @brief What the capture thread does when the ring buffer is full.
+         */
+        Globals::FrameReaderPolicies m_frameReaderPolicy;
+
+        /**
+         * @brief The resolution of the input video stream, which is empty until it is known.
+         */
+        cv::Size m_frameSize;
+
+        /**
+         * @brief The index of the oldest decoded frame within the ring buffer.
+         */
+        uint32_t m_readIndex;
+
+        /**
+         * @brief The number of decoded frames waiting in the ring buffer.
+         */
+        uint32_t m_queueDepth;
+
+        /**
+         * @brief The number of decoded frames that have been overwritten before being read.
+         */
+        uint32_t m_droppedFrames;
+
+        /**
+         * @brief Whether the capture thread has finished because the end of the input video stream has been reached.
+         */
+        bool m_endOfStream;
+
+        /**
+         * @brief Whether the %FrameReader is being released.
+         */
+        bool m_stopping;
+    };
+}
@@ -38,6 +38,20 @@ namespace LaneAndObjectDetection::Globals
         class SQLiteDatabaseError : public std::exception
         {
         };
+
+        /**
+         * @brief Used for performance test checks that have failed.
+         */
+        class PerformanceTestError : public std::exception
+        {
+        };
+
+        /**
+         * @brief Used when the INT8 backend is requested but no calibration frames could be read.
+         */
+        class CalibrationDataError : public std::exception
+        {
+        };
     }
 
     /**
@@ -94,10 +108,11 @@ namespace LaneAndObjectDetection::Globals
     /**
      * @brief CLI help message for the video manager.
      */
-    static inline const std::string G_CLI_HELP_MESSAGE = "\nUsage: lane-and-object-detection --input ... --yolo-folder-path ... [optional]\n\nOPTIONS:\n\nGeneric Options:\n\n  -h --help                       Display available options\n\nRequired Options:\n\n  -i --input                      File path or camera ID\n  -y --yolo-folder-path           Path to the yolo folder\n\nOptional options:\n\n  -o --object-detector-type       One of: none, standard or tiny (default = none)\n  -b --object-detector-backend    One of: cpu, gpu or cuda (default = cpu)\n  -s --object-detector-blob-size  One of: 208, 320, 416, 512 or 608 (default = 208)\n\n";
+    static inline const std::string G_CLI_HELP_MESSAGE = "\nUsage: lane-and-object-detection --input ... --yolo-folder-path ... [optional]\n\nOPTIONS:\n\nGeneric Options:\n\n  -h --help                       Display available options\n\nRequired Options:\n\n  -i --input                      File path or camera ID\n  -y --yolo-folder-path           Path to the yolo folder\n\nOptional options:\n\n  -o --object-detector-type       One of: none, standard or tiny (default = none)\n  -b --object-detector-backend    One of: cpu, gpu, cuda, cpu-fp16 or cpu-int8 (default = cpu)\n  -s --object-detector-blob-size  One of: 208, 320, 416, 512 or 608 (default = 208)\n  -n --object-detector-batch-size Number of frames per forward pass in sequential mode (default = 1)\n  -d --object-detector-interval   Run the object detector every N frames or adaptive (default = 1)\n  -c --horizon-crop               Also run the object detector on a crop around the horizon for distant objects\n  -t --target-fps                 Switch the object detector type and blob size to hold a target FPS (default = none)\n  -l --lane-detector-scale        One of: full, half or quarter (default = full)\n  -m --processing-mode            One of: sequential, concurrent or pipelined (default = sequential)\n  -f --frame-reader-policy        One of: block or drop-oldest (default = block)\n  -w --output-video-file-path     File path to record the output video to from the first frame (default = none)\n  -H --headless                   Run without any windows or keyboard input\n  -r --results-file-path          File path to stream per-frame results to or - for stdout (default = none)\n  -e --results-format             One of: json-lines or binary (default = json-lines)\n\n";
 
     /**
-     * @brief Input video dimensions.
+     * @brief The reference resolution that the region-of-interest and UI constants are defined at. Inputs are processed at
+     * their native resolution, see `FrameGeometry` for how these constants are mapped to it.
      */
     ///@{
     static inline const uint32_t G_VIDEO_INPUT_HEIGHT = 1080;
@@ -105,17 +120,61 @@ namespace LaneAndObjectDetection::Globals
     ///@}
 
     /**
-     * @brief Output video dimensions.
+     * @brief Output video FPS
      */
-    ///@{
-    static inline const uint32_t G_VIDEO_OUTPUT_HEIGHT = 1080;
-    static inline const uint32_t G_VIDEO_OUTPUT_WIDTH = 1920;
-    ///@}
+    static inline const uint32_t G_VIDEO_OUTPUT_FPS = 30;
 
     /**
-     * @brief Output video FPS
+     * @brief The supported modes for processing frames. Sequential mode runs every stage one after another on a single
+     * thread. Concurrent mode runs the lane detector front-end alongside the object detector on the same frame. Pipelined
+     * mode runs capture, object detection, lane detection and output on their own threads so that consecutive frames are
+     * processed concurrently.
      */
-    static inline const uint32_t G_VIDEO_OUTPUT_FPS = 30;
+    enum class ProcessingModes : std::uint8_t
+    {
+        SEQUENTIAL = 0,
+        PIPELINED,
+        CONCURRENT
+    };
+
+    /**
+     * @brief The maximum number of frames that can be waiting between two pipeline stages.
+     */
+    static inline const uint32_t G_PIPELINE_QUEUE_CAPACITY = 2;
+
+    /**
+     * @brief What the frame reader does when its ring buffer of decoded frames is full. Blocking ensures that no frames are
+     * lost (suited to video files), while dropping the oldest frame ensures that the newest frame is always processed (suited
+     * to live cameras).
+     */
+    enum class FrameReaderPolicies : std::uint8_t
+    {
+        BLOCK = 0,
+        DROP_OLDEST
+    };
+
+    /**
+     * @brief The number of preallocated frames in the frame reader ring buffer.
+     */
+    static inline const uint32_t G_FRAME_READER_RING_BUFFER_SIZE = 4;
+
+    /**
+     * @brief The supported formats for the per-frame results stream. JSON Lines writes one JSON object per line and frame,
+     * while binary writes a compact fixed-layout record per frame (see ResultsWriter).
+     */
+    enum class ResultsFormats : std::uint8_t
+    {
+        JSON_LINES = 0,
+        BINARY
+    };
+
+    /**
+     * @brief The header written at the start of a binary results stream to identify it and its record layout.
+     */
+    ///@{
+    static inline const std::array<char, 4> G_RESULTS_BINARY_MAGIC = {'L', 'A', 'O', 'D'};
+    static inline const uint32_t G_RESULTS_BINARY_VERSION = 1;
+    ///@}
 
     /**
      * @brief Keyboard values when getting user input.
@@ -214,9 +273,12 @@ namespace LaneAndObjectDetection::Globals
     static inline const cv::Rect G_UI_RECT_TIMESTAMP = cv::Rect(0, G_VIDEO_INPUT_HEIGHT - G_UI_BOTTOM_BAR_HEIGHT, 300, G_UI_BOTTOM_BAR_HEIGHT);
 
     /**
-     * @brief Performance-related information UI location.
+     * @brief Performance-related information UI locations.
      */
-    static inline const cv::Rect G_UI_RECT_FPS = cv::Rect(300, G_VIDEO_INPUT_HEIGHT - G_UI_BOTTOM_BAR_HEIGHT, 300, G_UI_BOTTOM_BAR_HEIGHT);
+    ///@{
+    static inline const cv::Rect G_UI_RECT_FPS = cv::Rect(300, G_VIDEO_INPUT_HEIGHT - G_UI_BOTTOM_BAR_HEIGHT, 300, G_UI_TITLE_HEIGHT);
+    static inline const cv::Rect G_UI_RECT_FRAME_READER = cv::Rect(300, G_VIDEO_INPUT_HEIGHT - G_UI_SUBTITLE_HEIGHT, 300, G_UI_SUBTITLE_HEIGHT);
+    ///@}
 
     /**
      * @brief Driving state UI location (width is the entire screen for centering).
@@ -293,7 +355,7 @@ namespace LaneAndObjectDetection::Globals
     ///@}
 
     /**
-     * @brief The bounding box of the region-of-interest which is used to crop debugging frames. The '#' characters show the
+     * @brief The bounding box of the region-of-interest which the lane detector crops the frame to. The '#' characters show the
      * bounding box with respect to the region-of-interest.
      *
      *                #######____________________######## < Start Y
@@ -314,6 +376,19 @@ namespace LaneAndObjectDetection::Globals
     static inline const uint32_t G_ROI_BOUNDING_BOX_END_Y = G_ROI_BOTTOM_HEIGHT + G_ROI_BOUND_BOX_PADDING;
     static inline const cv::Range G_ROI_BOUNDING_BOX_X_RANGE = cv::Range(G_ROI_BOUNDING_BOX_START_X, G_ROI_BOUNDING_BOX_END_X);
     static inline const cv::Range G_ROI_BOUNDING_BOX_Y_RANGE = cv::Range(G_ROI_BOUNDING_BOX_START_Y, G_ROI_BOUNDING_BOX_END_Y);
+    static inline const cv::Point G_ROI_BOUNDING_BOX_ORIGIN = cv::Point(G_ROI_BOUNDING_BOX_START_X, G_ROI_BOUNDING_BOX_START_Y);
+    static inline const cv::Size G_ROI_BOUNDING_BOX_SIZE = cv::Size(G_ROI_BOUNDING_BOX_END_X - G_ROI_BOUNDING_BOX_START_X, G_ROI_BOUNDING_BOX_END_Y - G_ROI_BOUNDING_BOX_START_Y);
+    ///@}
+
+    /**
+     * @brief The fixed-point weights used to convert BGR pixels to grey, which are the ITU-R BT.601 luma weights scaled by
+     * 2^`G_GREY_WEIGHT_SHIFT` (the same as those used by `cv::cvtColor` so that the results are identical).
+     */
+    ///@{
+    static inline const uint32_t G_GREY_BLUE_WEIGHT = 1868;
+    static inline const uint32_t G_GREY_GREEN_WEIGHT = 9617;
+    static inline const uint32_t G_GREY_RED_WEIGHT = 4899;
+    static inline const int32_t G_GREY_WEIGHT_SHIFT = 14;
     ///@}
 
     /**
@@ -321,6 +396,11 @@ namespace LaneAndObjectDetection::Globals
      */
     static inline const double G_DEBUGGING_FRAME_SCALING_FACTOR = static_cast<double>(G_VIDEO_INPUT_WIDTH / 3.0) / static_cast<double>(G_ROI_BOUNDING_BOX_END_X - G_ROI_BOUNDING_BOX_START_X);
 
+    /**
+     * @brief The number of fractional bits in the co-ordinates of the hough lines drawn on the debugging frames.
+     */
+    static inline const int32_t G_DEBUGGING_FRAME_LINE_SHIFT = 4;
+
     /**
      * @brief The index values which represent each corner of `G_ROI_MASK_POINTS`.
      */
@@ -366,6 +446,18 @@ namespace LaneAndObjectDetection::Globals
     static inline const double G_RIGHT_LINE_THRESHOLD_C = G_ROI_TOP_HEIGHT - (G_RIGHT_LINE_THRESHOLD_M * G_TOP_MID_POINT_X_LOCATION);
     ///@}
 
+    /**
+     * @brief The supported resolutions for the lane detector to process the region-of-interest at, where each value is the
+     * factor that the region-of-interest is downscaled by. The lower the resolution the less CPU time the lane detector takes
+     * at the cost of missing fainter and thinner road markings.
+     */
+    enum class LaneDetectorScales : std::uint8_t
+    {
+        FULL = 1,
+        HALF = 2,
+        QUARTER = 4
+    };
+
     /**
      * @brief Canny algorithm thresholds.
      */
@@ -374,6 +466,16 @@ namespace LaneAndObjectDetection::Globals
     static inline const uint32_t G_CANNY_ALGORITHM_UPPER_THRESHOLD = 255;
     ///@}
 
+    /**
+     * @brief Striped Canny algorithm properties. Each stripe is extended by the halo rows above and below so that the
+     * gradients, non-maximum suppression and most of the hysteresis at the stripe boundaries see the same neighbourhood as
+     * they would in the full frame.
+     */
+    ///@{
+    static inline const int32_t G_CANNY_STRIPE_MINIMUM_HEIGHT = 32;
+    static inline const int32_t G_CANNY_STRIPE_HALO_ROWS = 16;
+    ///@}
+
     /**
      * @brief Hough transform threshold and properties.
      */
@@ -400,11 +502,57 @@ namespace LaneAndObjectDetection::Globals
      */
     static inline const double G_HOUGH_LINE_HORIZONTAL_GRADIENT_THRESHOLD = 0.5;
 
+    /**
+     * @brief How the lane detector classified each hough line, in the order that the checks are made. Only left, middle and
+     * right lines are used, the others are discarded as noise.
+     */
+    enum class HoughLineTypes : std::uint8_t
+    {
+        VERTICAL = 0,
+        HORIZONTAL,
+        WITHIN_OBJECT,
+        LEFT_EDGE,
+        LEFT,
+        RIGHT_EDGE,
+        RIGHT,
+        MIDDLE
+    };
+
+    /**
+     * @brief The number of hough lines that the hough line classifier reserves space for, which its buffers grow beyond if
+     * needed.
+     */
+    static inline const uint32_t G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY = 512;
+
+    /**
+     * @brief The colour that each type of hough line is drawn in debug mode, indexed by `HoughLineTypes`.
+     */
+    static inline const std::array<cv::Scalar, 8> G_HOUGH_LINE_TYPE_COLOURS = {
+        G_COLOUR_WHITE,      // Vertical
+        G_COLOUR_GREY,       // Horizontal
+        G_COLOUR_YELLOW,     // Within an object
+        G_COLOUR_LIGHT_RED,  // Left edge of the mask
+        G_COLOUR_RED,        // Left
+        G_COLOUR_LIGHT_BLUE, // Right edge of the mask
+        G_COLOUR_BLUE,       // Right
+        G_COLOUR_GREEN,      // Middle
+    };
+
     /**
      * @brief Threshold length to decide whether a line is to be considered solid line road marking.
      */
     static inline const uint32_t G_SOLID_LINE_LENGTH_THRESHOLD = 175;
 
+    /**
+     * @brief The types of lane line that can be detected on either side of the vehicle.
+     */
+    enum class LineTypes : std::uint8_t
+    {
+        EMPTY = 0,
+        DASHED,
+        SOLID
+    };
+
     /**
      * @brief The different driving states supported by the lane detector.
      */
@@ -452,14 +600,18 @@ namespace LaneAndObjectDetection::Globals
     /**
      * @brief The supported backends for the object detector to run on. In theory, GPU should be significantly more performant.
      * For maximum performance CUDA should be used as the backend, however, this requires building OpenCV with CUDA which is not
-     * supported with this projects built-in installation script.
+     * supported with this projects built-in installation script. For CPU-only hosts, the FP16 backend runs the network in half
+     * precision on CPUs that support it (falling back to CPU otherwise) and the INT8 backend runs a copy of the network
+     * quantised using frames from the calibration folder, trading some detection accuracy for speed.
      */
     enum class ObjectDetectorBackEnds : std::uint8_t
     {
         NONE = 0,
         CPU,
         GPU,
-        CUDA
+        CUDA,
+        CPU_FP16,
+        CPU_INT8
     };
 
     /**
@@ -476,6 +628,42 @@ namespace LaneAndObjectDetection::Globals
         FIVE = 608
     };
 
+    /**
+     * @brief The formats that the object detector models can be loaded from. ONNX models exported from PyTorch (with the grid
+     * included) output bounding boxes in pixels of the blob and class scores that have not been multiplied by the objectness
+     * score, unlike Darknet models.
+     */
+    enum class ModelFormats : std::uint8_t
+    {
+        DARKNET = 0,
+        ONNX
+    };
+
+    /**
+     * @brief The file names (without extensions) of the object detector models within the YOLO folder, and the extensions of
+     * each of the files that a model can be loaded from. A model is loaded from the first of an ONNX model, a model bundle or
+     * the `.cfg` and `.weights` YOLO files that exists.
+     */
+    ///@{
+    static inline const std::string G_YOLO_TINY_MODEL_NAME = "yolov7-tiny";
+    static inline const std::string G_YOLO_STANDARD_MODEL_NAME = "yolov7";
+    static inline const std::string G_MODEL_ONNX_EXTENSION = ".onnx";
+    static inline const std::string G_MODEL_BUNDLE_EXTENSION = ".bundle";
+    static inline const std::string G_MODEL_CFG_EXTENSION = ".cfg";
+    static inline const std::string G_MODEL_WEIGHTS_EXTENSION = ".weights";
+    ///@}
+
+    /**
+     * @brief The header written at the start of a model bundle to identify it and its layout. The header is followed by the
+     * offset and size (uint64) of the `.cfg` and then of the `.weights` YOLO file, each of which starts on a multiple of
+     * `G_MODEL_BUNDLE_ALIGNMENT` bytes so that they are page aligned when memory-mapped.
+     */
+    ///@{
+    static inline const std::array<char, 8> G_MODEL_BUNDLE_MAGIC = {'L', 'A', 'O', 'D', 'Y', 'O', 'L', 'O'};
+    static inline const uint32_t G_MODEL_BUNDLE_VERSION = 1;
+    static inline const uint64_t G_MODEL_BUNDLE_ALIGNMENT = 4096;
+    ///@}
+
     /**
      * @brief Object detection threshold and properties.
      */
@@ -485,6 +673,24 @@ namespace LaneAndObjectDetection::Globals
     static inline const double G_OBJECT_DETECTOR_NMS_THRESHOLD = 0.4;
     ///@}
 
+    /**
+     * @brief Non-maxima suppression properties. When class-aware, a candidate is only suppressed by a kept candidate of the
+     * same class, otherwise by a kept candidate of any class. At most `G_OBJECT_DETECTOR_NMS_TOP_K` candidates are kept per
+     * frame (0 for no limit). The vectorised intersection-over-union decides candidates further than
+     * `G_OBJECT_DETECTOR_NMS_EXACT_MARGIN` from the threshold, and the rest are decided exactly as `cv::dnn::NMSBoxes` does.
+     */
+    ///@{
+    static inline const bool G_OBJECT_DETECTOR_NMS_CLASS_AWARE = true;
+    static inline const uint32_t G_OBJECT_DETECTOR_NMS_TOP_K = 100;
+    static inline const float G_OBJECT_DETECTOR_NMS_EXACT_MARGIN = 1e-4F;
+    ///@}
+
+    /**
+     * @brief The value (after scaling) that the letterbox pads the blob with, which is the same grey that Darknet letterboxes
+     * with during training.
+     */
+    static inline const float G_OBJECT_DETECTOR_LETTERBOX_PADDING = 0.5F;
+
     /**
      * @brief Object detection bounding box properties.
      */
@@ -505,9 +711,118 @@ namespace LaneAndObjectDetection::Globals
     static inline const int32_t G_OBJECT_DETECTOR_OUTPUT_BLOBS_CENTER_Y_COORD_INDEX = 1;
     static inline const int32_t G_OBJECT_DETECTOR_OUTPUT_BLOBS_WIDTH_INDEX = 2;
     static inline const int32_t G_OBJECT_DETECTOR_OUTPUT_BLOBS_HEIGHT_INDEX = 3;
+    static inline const int32_t G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECTNESS_INDEX = 4;
     static inline const int32_t G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECT_SCORES_START_INDEX = 5;
     ///@}
 
+    /**
+     * @brief The number of candidate detections that the YOLO output decoder reserves space for up front.
+     */
+    static inline const uint32_t G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY = 1024;
+
+    /**
+     * @brief The object detector interval which adapts the number of frames between detections to how well the object
+     * tracker predicts them, up to `G_OBJECT_DETECTOR_MAXIMUM_ADAPTIVE_INTERVAL`. The interval is increased by one after
+     * each detection where the tracker agreement is at least `G_OBJECT_DETECTOR_ADAPTIVE_AGREEMENT_THRESHOLD` and is
+     * otherwise reset to one.
+     */
+    ///@{
+    static inline const uint32_t G_OBJECT_DETECTOR_ADAPTIVE_INTERVAL = 0;
+    static inline const uint32_t G_OBJECT_DETECTOR_MAXIMUM_ADAPTIVE_INTERVAL = 8;
+    static inline const double G_OBJECT_DETECTOR_ADAPTIVE_AGREEMENT_THRESHOLD = 0.7;
+    ///@}
+
+    /**
+     * @brief The square crop around the horizon that is run through the object detector alongside the full frame when the
+     * horizon crop is enabled. The crop is `G_OBJECT_DETECTOR_HORIZON_CROP_SIZE` pixels at the reference resolution, centred
+     * horizontally and on the top of the region-of-interest (where the road meets the horizon), so distant vehicles are
+     * letterboxed at several times the scale of the full frame. Detections within `G_OBJECT_DETECTOR_HORIZON_CROP_BORDER`
+     * pixels of an edge of the crop inside the frame are cut off, so are left to the full frame.
+     */
+    ///@{
+    static inline const int32_t G_OBJECT_DETECTOR_HORIZON_CROP_SIZE = 512;
+    static inline const int32_t G_OBJECT_DETECTOR_HORIZON_CROP_BORDER = 4;
+    ///@}
+
+    /**
+     * @brief Object tracker properties. A detection is only associated with a track of the same class whose predicted
+     * bounding box overlaps it by at least `G_OBJECT_TRACKER_IOU_THRESHOLD`. The velocity measured at each detection is
+     * weighted by `G_OBJECT_TRACKER_VELOCITY_SMOOTHING` against the previous velocity.
+     */
+    ///@{
+    static inline const double G_OBJECT_TRACKER_IOU_THRESHOLD = 0.3;
+    static inline const double G_OBJECT_TRACKER_VELOCITY_SMOOTHING = 0.5;
+    static inline const uint32_t G_OBJECT_TRACKER_INITIAL_CAPACITY = 64;
+    ///@}
+
+    /**
+     * @brief The quality levels that the quality controller steps between, in ascending order of cost. Every blob size of
+     * the tiny object detector is cheaper than the smallest blob size of the standard object detector.
+     */
+    ///@{
+    static inline const uint32_t G_QUALITY_CONTROLLER_NUMBER_OF_LEVELS = 10;
+    static inline const std::array<ObjectDetectorTypes, G_QUALITY_CONTROLLER_NUMBER_OF_LEVELS> G_QUALITY_CONTROLLER_OBJECT_DETECTOR_TYPES = {
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+    };
+    static inline const std::array<ObjectDetectorBlobSizes, G_QUALITY_CONTROLLER_NUMBER_OF_LEVELS> G_QUALITY_CONTROLLER_BLOB_SIZES = {
+        ObjectDetectorBlobSizes::ONE,
+        ObjectDetectorBlobSizes::TWO,
+        ObjectDetectorBlobSizes::THREE,
+        ObjectDetectorBlobSizes::FOUR,
+        ObjectDetectorBlobSizes::FIVE,
+        ObjectDetectorBlobSizes::ONE,
+        ObjectDetectorBlobSizes::TWO,
+        ObjectDetectorBlobSizes::THREE,
+        ObjectDetectorBlobSizes::FOUR,
+        ObjectDetectorBlobSizes::FIVE,
+    };
+    ///@}
+
+    /**
+     * @brief Quality controller properties. The frame times are smoothed by an exponential moving average weighted by
+     * `G_QUALITY_CONTROLLER_SMOOTHING`. The quality is lowered once the average has been more than
+     * `G_QUALITY_CONTROLLER_DOWNGRADE_MARGIN` over the frame time budget, or raised once it has been more than
+     * `G_QUALITY_CONTROLLER_UPGRADE_MARGIN` under it, for `G_QUALITY_CONTROLLER_HOLD_FRAMES` frames in a row. After a
+     * change, no further change is made for `G_QUALITY_CONTROLLER_COOLDOWN_FRAMES` frames while the average settles, and the
+     * level that was just lowered from cannot be returned to for `G_QUALITY_CONTROLLER_UPGRADE_BACKOFF_FRAMES` frames. A
+     * target of `G_QUALITY_CONTROLLER_DISABLED` frames per second disables the controller.
+     */
+    ///@{
+    static inline const double G_QUALITY_CONTROLLER_DISABLED = 0;
+    static inline const double G_QUALITY_CONTROLLER_SMOOTHING = 0.1;
+    static inline const double G_QUALITY_CONTROLLER_DOWNGRADE_MARGIN = 0.1;
+    static inline const double G_QUALITY_CONTROLLER_UPGRADE_MARGIN = 0.3;
+    static inline const uint32_t G_QUALITY_CONTROLLER_HOLD_FRAMES = 15;
+    static inline const uint32_t G_QUALITY_CONTROLLER_COOLDOWN_FRAMES = 30;
+    static inline const uint32_t G_QUALITY_CONTROLLER_UPGRADE_BACKOFF_FRAMES = 300;
+    ///@}
+
+    /**
+     * @brief The number of warmed up networks that the object detector keeps loaded. Each configuration (type, backend and
+     * blob size) is a separate network as the layer buffers are allocated for a single blob size.
+     */
+    static inline const uint32_t G_NETWORK_CACHE_CAPACITY = 4;
+
+    /**
+     * @brief INT8 calibration settings. The INT8 backend quantises the network using up to
+     * `G_OBJECT_DETECTOR_CALIBRATION_NUMBER_OF_FRAMES` images from the calibration folder within the YOLO folder, which should
+     * be frames from the footage the detector will be run against. The model converter can sample them from a video.
+     */
+    ///@{
+    static inline const std::string G_OBJECT_DETECTOR_CALIBRATION_FOLDER_NAME = "calibration";
+    static inline const std::string G_OBJECT_DETECTOR_CALIBRATION_FRAME_EXTENSION = ".png";
+    static inline const uint32_t G_OBJECT_DETECTOR_CALIBRATION_NUMBER_OF_FRAMES = 32;
+    ///@}
+
     /**
      * @brief Names of detectable objects. The order is significant and should not be changed.
      */
@@ -684,87 +999,152 @@ namespace LaneAndObjectDetection::Globals
         {"zebra",          G_COLOUR_WHITE },
     };
 
+    /**
+     * @brief CLI help message for the model converter.
+     */
+    static inline const std::string G_MODEL_CONVERTER_CLI_HELP_MESSAGE = "Usage: lane-and-object-detection-model-converter --yolo-folder-path ... [optional]\n\nOPTIONS:\n\nGeneric Options:\n\n-h --help              Display available options\n\nRequired Options:\n\n-y --yolo-folder-path  Path to the yolo folder, where a bundle is written next to each pair of .cfg and .weights files\n\nOptional Options:\n\n-c --calibration-input Video file path to sample INT8 calibration frames from in to the yolo folder (default = none)";
+
     /**
      * @brief CLI help message for the performance tests.
      */
-    static inline const std::string G_PERFORMANCE_TESTS_CLI_HELP_MESSAGE = "Usage: lane-and-object-detection-performance-tests --platform ... --database-path ... --input ... --yolo-folder-path ... --repetitions ...\n\nOPTIONS:\n\nGeneric Options:\n\n-h --help              Display available options\n\nRequired Options:\n\n-p --platform          The current platform being tested\n-d --database-path     Path to SQLite database file\n-i --input             Benchmark video file path\n-y --yolo-folder-path  Path to the yolo configuration folder\n-r --repetitions       Number of repetitions for each test";
+    static inline const std::string G_PERFORMANCE_TESTS_CLI_HELP_MESSAGE = "Usage: lane-and-object-detection-performance-tests --platform ... --database-path ... --input ... --yolo-folder-path ... --repetitions ... [optional]\n\nOPTIONS:\n\nGeneric Options:\n\n-h --help              Display available options\n\nRequired Options:\n\n-p --platform          The current platform being tested\n-d --database-path     Path to SQLite database file\n-i --input             Benchmark video file path\n-y --yolo-folder-path  Path to the yolo configuration folder\n-r --repetitions       Number of repetitions for each test\n\nOptional Options:\n\n-c --checks            Run the micro-benchmarks and checks instead of the video tests (only --input and --yolo-folder-path are required)\n-q --quantised         Also run the video tests on the quantised CPU backends";
 
     /**
      * @brief Performance tests settings.
      */
     ///@{
-    static inline const uint32_t G_PERFORMANCE_TESTS_NUMBER_OF_TESTS = 21;
+    static inline const uint32_t G_PERFORMANCE_TESTS_NUMBER_OF_TESTS = 41;
 
     static inline const std::array<std::string, G_PERFORMANCE_TESTS_NUMBER_OF_TESTS> G_PERFORMANCE_TESTS_NAMES = {
         "No YOLO",
         "YOLO-tiny 288 (CPU)",
         "YOLO-tiny 288 (GPU)",
+        "YOLO-tiny 288 (CPU FP16)",
+        "YOLO-tiny 288 (CPU INT8)",
         "YOLO 288 (CPU)",
         "YOLO 288 (GPU)",
+        "YOLO 288 (CPU FP16)",
+        "YOLO 288 (CPU INT8)",
         "YOLO-tiny 320 (CPU)",
         "YOLO-tiny 320 (GPU)",
+        "YOLO-tiny 320 (CPU FP16)",
+        "YOLO-tiny 320 (CPU INT8)",
         "YOLO 320 (CPU)",
         "YOLO 320 (GPU)",
+        "YOLO 320 (CPU FP16)",
+        "YOLO 320 (CPU INT8)",
         "YOLO-tiny 416 (CPU)",
         "YOLO-tiny 416 (GPU)",
+        "YOLO-tiny 416 (CPU FP16)",
+        "YOLO-tiny 416 (CPU INT8)",
         "YOLO 416 (CPU)",
         "YOLO 416 (GPU)",
+        "YOLO 416 (CPU FP16)",
+        "YOLO 416 (CPU INT8)",
         "YOLO-tiny 512 (CPU)",
         "YOLO-tiny 512 (GPU)",
+        "YOLO-tiny 512 (CPU FP16)",
+        "YOLO-tiny 512 (CPU INT8)",
         "YOLO 512 (CPU)",
         "YOLO 512 (GPU)",
+        "YOLO 512 (CPU FP16)",
+        "YOLO 512 (CPU INT8)",
         "YOLO-tiny 608 (CPU)",
         "YOLO-tiny 608 (GPU)",
+        "YOLO-tiny 608 (CPU FP16)",
+        "YOLO-tiny 608 (CPU INT8)",
         "YOLO 608 (CPU)",
         "YOLO 608 (GPU)",
+        "YOLO 608 (CPU FP16)",
+        "YOLO 608 (CPU INT8)",
     };
 
     static inline const std::array<ObjectDetectorTypes, G_PERFORMANCE_TESTS_NUMBER_OF_TESTS> G_PERFORMANCE_TESTS_OBJECT_DETECTOR_TYPES = {
         ObjectDetectorTypes::NONE,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::STANDARD,
         ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::STANDARD,
         ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::STANDARD,
         ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::STANDARD,
         ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::TINY,
+        ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::TINY,
         ObjectDetectorTypes::STANDARD,
         ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
+        ObjectDetectorTypes::STANDARD,
     };
 
     static inline const std::array<ObjectDetectorBackEnds, G_PERFORMANCE_TESTS_NUMBER_OF_TESTS> G_PERFORMANCE_TESTS_BACK_END_TYPES = {
         ObjectDetectorBackEnds::NONE,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
         ObjectDetectorBackEnds::CPU,
         ObjectDetectorBackEnds::GPU,
+        ObjectDetectorBackEnds::CPU_FP16,
+        ObjectDetectorBackEnds::CPU_INT8,
     };
 
     static inline const std::array<ObjectDetectorBlobSizes, G_PERFORMANCE_TESTS_NUMBER_OF_TESTS> G_PERFORMANCE_TESTS_BLOB_SIZES = {
@@ -773,22 +1153,191 @@ namespace LaneAndObjectDetection::Globals
         ObjectDetectorBlobSizes::ONE,
         ObjectDetectorBlobSizes::ONE,
         ObjectDetectorBlobSizes::ONE,
+        ObjectDetectorBlobSizes::ONE,
+        ObjectDetectorBlobSizes::ONE,
+        ObjectDetectorBlobSizes::ONE,
+        ObjectDetectorBlobSizes::ONE,
+        ObjectDetectorBlobSizes::TWO,
+        ObjectDetectorBlobSizes::TWO,
         ObjectDetectorBlobSizes::TWO,
         ObjectDetectorBlobSizes::TWO,
         ObjectDetectorBlobSizes::TWO,
         ObjectDetectorBlobSizes::TWO,
+        ObjectDetectorBlobSizes::TWO,
+        ObjectDetectorBlobSizes::TWO,
+        ObjectDetectorBlobSizes::THREE,
+        ObjectDetectorBlobSizes::THREE,
         ObjectDetectorBlobSizes::THREE,
         ObjectDetectorBlobSizes::THREE,
         ObjectDetectorBlobSizes::THREE,
         ObjectDetectorBlobSizes::THREE,
+        ObjectDetectorBlobSizes::THREE,
+        ObjectDetectorBlobSizes::THREE,
+        ObjectDetectorBlobSizes::FOUR,
+        ObjectDetectorBlobSizes::FOUR,
         ObjectDetectorBlobSizes::FOUR,
         ObjectDetectorBlobSizes::FOUR,
         ObjectDetectorBlobSizes::FOUR,
         ObjectDetectorBlobSizes::FOUR,
+        ObjectDetectorBlobSizes::FOUR,
+        ObjectDetectorBlobSizes::FOUR,
+        ObjectDetectorBlobSizes::FIVE,
+        ObjectDetectorBlobSizes::FIVE,
+        ObjectDetectorBlobSizes::FIVE,
+        ObjectDetectorBlobSizes::FIVE,
         ObjectDetectorBlobSizes::FIVE,
         ObjectDetectorBlobSizes::FIVE,
         ObjectDetectorBlobSizes::FIVE,
         ObjectDetectorBlobSizes::FIVE,
     };
     ///@}
+
+    /**
+     * @brief Micro-benchmark settings. The synthetic output blobs have the same number of rows as the YOLOv7 output blobs for
+     * a blob size of 416 and contain a detection every `G_PERFORMANCE_TESTS_SYNTHETIC_DETECTION_ROW_INTERVAL` rows.
+     */
+    ///@{
+    static inline const uint32_t G_PERFORMANCE_TESTS_MICRO_BENCHMARK_WARM_UP_ITERATIONS = 10;
+    static inline const uint32_t G_PERFORMANCE_TESTS_MICRO_BENCHMARK_ITERATIONS = 1000;
+    static inline const uint64_t G_PERFORMANCE_TESTS_RANDOM_SEED = 42;
+    static inline const std::array<int32_t, 3> G_PERFORMANCE_TESTS_SYNTHETIC_OUTPUT_BLOB_ROWS = {507, 2028, 8112};
+    static inline const int32_t G_PERFORMANCE_TESTS_SYNTHETIC_DETECTION_ROW_INTERVAL = 50;
+    static inline const float G_PERFORMANCE_TESTS_SYNTHETIC_BACKGROUND_SCORE = 0.3F;
+    static inline const float G_PERFORMANCE_TESTS_SYNTHETIC_OBJECTNESS_SCORE = 0.9F;
+    static inline const float G_PERFORMANCE_TESTS_SYNTHETIC_CLASS_SCORE = 0.8F;
+    ///@}
+
+    /**
+     * @brief Object detector allocation test settings. The first frame of the benchmark video is run through the object
+     * detector while holding the snapshots of the last `G_PERFORMANCE_TESTS_ALLOCATION_HELD_SNAPSHOTS` frames, as many as can
+     * be in the pipeline at once.
+     */
+    ///@{
+    static inline const ObjectDetectorTypes G_PERFORMANCE_TESTS_ALLOCATION_OBJECT_DETECTOR_TYPE = ObjectDetectorTypes::TINY;
+    static inline const ObjectDetectorBlobSizes G_PERFORMANCE_TESTS_ALLOCATION_BLOB_SIZE = ObjectDetectorBlobSizes::ONE;
+    static inline const uint32_t G_PERFORMANCE_TESTS_ALLOCATION_HELD_SNAPSHOTS = (2 * G_PIPELINE_QUEUE_CAPACITY) + 3;
+    static inline const uint32_t G_PERFORMANCE_TESTS_ALLOCATION_ITERATIONS = 20;
+    ///@}
+
+    /**
+     * @brief The number of pixels per row, at the edges of the region-of-interest, that the fused grey conversion can differ
+     * from the masked `cv::cvtColor` by due to the mask being rasterised differently.
+     */
+    static inline const int32_t G_PERFORMANCE_TESTS_GREY_CONVERSION_MAXIMUM_EDGE_DIFFERENCES_PER_ROW = 2;
+
+    /**
+     * @brief Striped Canny test settings. The hough lines found using the striped Canny algorithm must be within
+     * `G_PERFORMANCE_TESTS_HOUGH_LINE_ENDPOINT_TOLERANCE` pixels of those found using `cv::Canny` for at least
+     * `G_PERFORMANCE_TESTS_HOUGH_LINE_MINIMUM_MATCHED_PROPORTION` of the lines (and vice versa).
+     */
+    ///@{
+    static inline const int32_t G_PERFORMANCE_TESTS_STRIPED_CANNY_NUMBER_OF_STRIPES = 4;
+    static inline const double G_PERFORMANCE_TESTS_HOUGH_LINE_ENDPOINT_TOLERANCE = 4;
+    static inline const double G_PERFORMANCE_TESTS_HOUGH_LINE_MINIMUM_MATCHED_PROPORTION = 0.9;
+    static inline const int32_t G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_LINE_INSET = 60;
+    static inline const int32_t G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_LINE_THICKNESS = 6;
+    static inline const int32_t G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_MINIMUM_INTENSITY = 40;
+    static inline const int32_t G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_MAXIMUM_INTENSITY = 80;
+    ///@}
+
+    /**
+     * @brief Letterbox test settings. The letterboxed blob must be within `G_PERFORMANCE_TESTS_LETTERBOX_TOLERANCE` of the
+     * blob created by `cv::dnn::blobFromImage` from the same resized frame.
+     */
+    ///@{
+    static inline const ObjectDetectorBlobSizes G_PERFORMANCE_TESTS_LETTERBOX_BLOB_SIZE = ObjectDetectorBlobSizes::THREE;
+    static inline const double G_PERFORMANCE_TESTS_LETTERBOX_TOLERANCE = 1e-6;
+    ///@}
+
+    /**
+     * @brief Object tracker test settings. A synthetic object moving at a constant velocity is detected every
+     * `G_PERFORMANCE_TESTS_OBJECT_TRACKER_INTERVAL` frames, and once the tracker has seen
+     * `G_PERFORMANCE_TESTS_OBJECT_TRACKER_WARM_UP_FRAMES` frames its predictions must overlap the object by at least
+     * `G_PERFORMANCE_TESTS_OBJECT_TRACKER_MINIMUM_IOU`.
+     */
+    ///@{
+    static inline const uint32_t G_PERFORMANCE_TESTS_OBJECT_TRACKER_INTERVAL = 4;
+    static inline const uint32_t G_PERFORMANCE_TESTS_OBJECT_TRACKER_NUMBER_OF_FRAMES = 64;
+    static inline const uint32_t G_PERFORMANCE_TESTS_OBJECT_TRACKER_WARM_UP_FRAMES = 16;
+    static inline const double G_PERFORMANCE_TESTS_OBJECT_TRACKER_MINIMUM_IOU = 0.9;
+    static inline const cv::Rect G_PERFORMANCE_TESTS_OBJECT_TRACKER_INITIAL_BOUNDING_BOX = cv::Rect(100, 400, 80, 60);
+    static inline const cv::Point G_PERFORMANCE_TESTS_OBJECT_TRACKER_VELOCITY = cv::Point(5, 2);
+    ///@}
+
+    /**
+     * @brief Quality controller test settings. Each quality level costs `G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_LEVEL_FRAME_TIME`
+     * more than the level below it, so starting from the highest level the controller must settle on
+     * `G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_EXPECTED_LEVEL`, the highest level within the budget of
+     * `G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_TARGET_FPS`, without ever raising the quality.
+     */
+    ///@{
+    static inline const double G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_TARGET_FPS = 30;
+    static inline const uint32_t G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_LEVEL_FRAME_TIME = 10000;
+    static inline const uint32_t G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_NUMBER_OF_FRAMES = 1000;
+    static inline const uint32_t G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_EXPECTED_LEVEL = 2;
+    ///@}
+
+    /**
+     * @brief Quantisation drift test settings. The detections of the quantised CPU backends on the first
+     * `G_PERFORMANCE_TESTS_QUANTISATION_NUMBER_OF_FRAMES` frames of the benchmark video are matched to those of the FP32 CPU
+     * backend, where a match is the same class with an intersection-over-union of at least
+     * `G_PERFORMANCE_TESTS_QUANTISATION_MINIMUM_IOU`, and both the proportion of FP32 detections matched and of quantised
+     * detections matched must be at least `G_PERFORMANCE_TESTS_QUANTISATION_MINIMUM_MATCHED_PROPORTION`.
+     */
+    ///@{
+    static inline const ObjectDetectorTypes G_PERFORMANCE_TESTS_QUANTISATION_OBJECT_DETECTOR_TYPE = ObjectDetectorTypes::TINY;
+    static inline const ObjectDetectorBlobSizes G_PERFORMANCE_TESTS_QUANTISATION_BLOB_SIZE = ObjectDetectorBlobSizes::THREE;
+    static inline const std::array<ObjectDetectorBackEnds, 2> G_PERFORMANCE_TESTS_QUANTISATION_BACK_ENDS = {ObjectDetectorBackEnds::CPU_FP16, ObjectDetectorBackEnds::CPU_INT8};
+    static inline const uint32_t G_PERFORMANCE_TESTS_QUANTISATION_NUMBER_OF_FRAMES = 100;
+    static inline const double G_PERFORMANCE_TESTS_QUANTISATION_MINIMUM_IOU = 0.5;
+    static inline const double G_PERFORMANCE_TESTS_QUANTISATION_MINIMUM_MATCHED_PROPORTION = 0.75;
+    ///@}
+
+    /**
+     * @brief Horizon crop test settings. The first `G_PERFORMANCE_TESTS_HORIZON_CROP_NUMBER_OF_FRAMES` frames of the benchmark
+     * video are run with and without the horizon crop, and without it at `G_PERFORMANCE_TESTS_HORIZON_CROP_REFERENCE_BLOB_SIZE`
+     * for comparison. Objects smaller than `G_PERFORMANCE_TESTS_HORIZON_CROP_SMALL_OBJECT_AREA` pixels at the reference
+     * resolution count as small, and the horizon crop must find at least
+     * `G_PERFORMANCE_TESTS_HORIZON_CROP_MINIMUM_REFERENCE_PROPORTION` of the small objects found at the reference blob size.
+     */
+    ///@{
+    static inline const ObjectDetectorTypes G_PERFORMANCE_TESTS_HORIZON_CROP_OBJECT_DETECTOR_TYPE = ObjectDetectorTypes::TINY;
+    static inline const ObjectDetectorBlobSizes G_PERFORMANCE_TESTS_HORIZON_CROP_BLOB_SIZE = ObjectDetectorBlobSizes::THREE;
+    static inline const ObjectDetectorBlobSizes G_PERFORMANCE_TESTS_HORIZON_CROP_REFERENCE_BLOB_SIZE = ObjectDetectorBlobSizes::FIVE;
+    static inline const uint32_t G_PERFORMANCE_TESTS_HORIZON_CROP_NUMBER_OF_FRAMES = 100;
+    static inline const double G_PERFORMANCE_TESTS_HORIZON_CROP_SMALL_OBJECT_AREA = 32 * 32;
+    static inline const double G_PERFORMANCE_TESTS_HORIZON_CROP_MINIMUM_REFERENCE_PROPORTION = 0.75;
+    ///@}
+
+    /**
+     * @brief Non-maxima suppression benchmark settings. `G_PERFORMANCE_TESTS_NMS_NUMBER_OF_CANDIDATES` candidates, all above
+     * the confidence threshold, are jittered around `G_PERFORMANCE_TESTS_NMS_NUMBER_OF_OBJECTS` objects of
+     * `G_PERFORMANCE_TESTS_NMS_NUMBER_OF_CLASSES` classes to mimic a dense scene.
+     */
+    ///@{
+    static inline const uint32_t G_PERFORMANCE_TESTS_NMS_NUMBER_OF_CANDIDATES = 600;
+    static inline const uint32_t G_PERFORMANCE_TESTS_NMS_NUMBER_OF_OBJECTS = 40;
+    static inline const uint32_t G_PERFORMANCE_TESTS_NMS_NUMBER_OF_CLASSES = 4;
+    static inline const int32_t G_PERFORMANCE_TESTS_NMS_MAXIMUM_JITTER = 12;
+    ///@}
+
+    /**
+     * @brief Object occupancy mask test settings. `G_PERFORMANCE_TESTS_OCCUPANCY_MASK_NUMBER_OF_LINES` lines, with ends
+     * scattered around the region-of-interest bounding box, are checked against
+     * `G_PERFORMANCE_TESTS_OCCUPANCY_MASK_NUMBER_OF_OBJECTS` object bounding boxes to mimic a busy motorway.
+     */
+    ///@{
+    static inline const uint32_t G_PERFORMANCE_TESTS_OCCUPANCY_MASK_NUMBER_OF_LINES = 500;
+    static inline const uint32_t G_PERFORMANCE_TESTS_OCCUPANCY_MASK_NUMBER_OF_OBJECTS = 40;
+    ///@}
+
+    /**
+     * @brief Hough line classifier test settings. `G_PERFORMANCE_TESTS_LINE_CLASSIFIER_NUMBER_OF_LINES` lines are scattered
+     * across the region-of-interest bounding box, every `G_PERFORMANCE_TESTS_LINE_CLASSIFIER_VERTICAL_LINE_INTERVAL`th of
+     * which is vertical. Every line must be classified the same as when classifying one line at a time.
+     */
+    ///@{
+    static inline const uint32_t G_PERFORMANCE_TESTS_LINE_CLASSIFIER_NUMBER_OF_LINES = 500;
+    static inline const uint32_t G_PERFORMANCE_TESTS_LINE_CLASSIFIER_VERTICAL_LINE_INTERVAL = 16;
+    ///@}
 }
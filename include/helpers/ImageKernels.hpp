@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Globals.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class ImageKernels
+     * @brief Fused, vectorised and parallel image processing kernels which replace chains of full-frame or single-threaded
+     * OpenCV calls in the hot path.
+     */
+    class ImageKernels
+    {
+    public:
+        /**
+         * @brief Disable constructing a new %ImageKernels object.
+         */
+        explicit ImageKernels() = delete;
+
+        /**
+         * @brief Computes the columns covered by a trapezoid with horizontal top and bottom edges for every row of
+         * `p_region`. Rows that the trapezoid does not cover are given an empty range.
+         *
+         * @param p_trapezoidPoints The corners of the trapezoid in the same order as `Globals::G_ROI_MASK_POINTS`.
+         * @param p_region The region of the frame that the row spans are relative to.
+         * @param p_rowSpans The columns covered by the trapezoid for each row of `p_region`, relative to `p_region`.
+         */
+        static void ComputeTrapezoidRowSpans(const std::array<cv::Point, Globals::G_NUMBER_OF_POINTS>& p_trapezoidPoints, const cv::Rect& p_region, std::vector<cv::Range>& p_rowSpans);
+
+        /**
+         * @brief Converts `p_bgrFrame` to grey in a single pass, only converting the pixels within `p_rowSpans` and setting
+         * every other pixel to zero. This gives the same result as masking the frame and then converting it to grey.
+         *
+         * @param p_bgrFrame The `CV_8UC3` frame to convert.
+         * @param p_rowSpans The columns to convert for each row of `p_bgrFrame`.
+         * @param p_greyFrame The `CV_8UC1` output frame, which is only reallocated if its size has changed.
+         */
+        static void ConvertMaskedBgrToGrey(const cv::Mat& p_bgrFrame, const std::vector<cv::Range>& p_rowSpans, cv::Mat& p_greyFrame);
+
+        /**
+         * @brief Converts a run of contiguous BGR pixels to grey.
+         *
+         * @param p_bgrPixels The interleaved BGR pixels to convert.
+         * @param p_greyPixels The grey pixels.
+         * @param p_numberOfPixels The number of pixels to convert.
+         */
+        static void ConvertBgrToGrey(const uint8_t* p_bgrPixels, uint8_t* p_greyPixels, const int32_t& p_numberOfPixels);
+
+        /**
+         * @brief Converts a run of contiguous BGR pixels to separate red, green and blue float planes multiplied by
+         * `p_scale`, which swaps the channel order, normalises and changes the layout from interleaved to planar in one pass.
+         *
+         * @param p_bgrPixels The interleaved BGR pixels to convert.
+         * @param p_redPlane The red values.
+         * @param p_greenPlane The green values.
+         * @param p_bluePlane The blue values.
+         * @param p_numberOfPixels The number of pixels to convert.
+         * @param p_scale The factor to multiply each value by.
+         */
+        static void ConvertBgrToScaledRgbPlanes(const uint8_t* p_bgrPixels, float* p_redPlane, float* p_greenPlane, float* p_bluePlane, const int32_t& p_numberOfPixels, const float& p_scale);
+
+        /**
+         * @brief Runs the Canny algorithm on horizontal stripes of `p_greyFrame` in parallel. Each stripe is extended by
+         * `Globals::G_CANNY_STRIPE_HALO_ROWS` above and below, and only its own rows are copied to `p_cannyFrame`. The result
+         * matches `cv::Canny` except where an edge is only connected to a strong edge through a path longer than the halo.
+         *
+         * @param p_greyFrame The `CV_8UC1` frame to detect edges in.
+         * @param p_cannyFrame The `CV_8UC1` edge frame, which is only reallocated if its size has changed.
+         * @param p_lowerThreshold The lower threshold of the hysteresis.
+         * @param p_upperThreshold The upper threshold of the hysteresis.
+         * @param p_numberOfStripes The number of stripes to split the frame into, which is reduced so that no stripe is
+         * shorter than `Globals::G_CANNY_STRIPE_MINIMUM_HEIGHT`.
+         * @param p_stripeBuffers The edge frames of each stripe including their halos, which are reused between calls.
+         */
+        static void RunStripedCanny(const cv::Mat& p_greyFrame,
+                                    cv::Mat& p_cannyFrame,
+                                    const double& p_lowerThreshold,
+                                    const double& p_upperThreshold,
+                                    const int32_t& p_numberOfStripes,
+                                    std::vector<cv::Mat>& p_stripeBuffers);
+    };
+}
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include <opencv2/core/mat.hpp>
+#include <opencv2/core/matx.hpp>
 #include <opencv2/core/types.hpp>
 
+#include "helpers/FrameGeometry.hpp"
+#include "helpers/Globals.hpp"
+
 /**
  * @namespace LaneAndObjectDetection
  * @brief Contains all Lane-and-Object-Detection objects.
@@ -33,9 +38,15 @@ namespace LaneAndObjectDetection
             cv::Scalar m_boundingBoxColour;
 
             /**
-             * @brief The name of the detected object.
+             * @brief The index of the detected object within `Globals::G_OBJECT_DETECTOR_OBJECT_NAMES`. The label is only
+             * formatted when the frame is rendered so that no strings are built by the object detector.
+             */
+            uint32_t m_classId;
+
+            /**
+             * @brief The confidence of the detection between 0 and 1.
              */
-            std::string m_objectName;
+            float m_confidence;
         };
 
         /**
@@ -50,19 +61,24 @@ namespace LaneAndObjectDetection
     struct LaneDetectionInformation
     {
         /**
-         * @brief The initial region-of-interest frame.
+         * @brief The initial region-of-interest frame, cropped to the ROI bounding box.
          */
         cv::Mat m_roiFrame;
 
         /**
-         * @brief The frame containing the edges detected by the Canny algorithm.
+         * @brief The frame containing the edges detected by the Canny algorithm, cropped to the ROI bounding box.
          */
         cv::Mat m_cannyFrame;
 
         /**
-         * @brief The frame contains the lines detected by the Hough transform.
+         * @brief The lines detected by the Hough transform in reference co-ordinates.
+         */
+        std::vector<cv::Vec4i> m_houghLines;
+
+        /**
+         * @brief The type of each of `m_houghLines`.
          */
-        cv::Mat m_houghLinesFrame;
+        std::vector<Globals::HoughLineTypes> m_houghLineTypes;
 
         /**
          * @brief The co-ordinate points that outline the current lane.
@@ -78,6 +94,21 @@ namespace LaneAndObjectDetection
          * @brief Either the lane line information or turning state depending upon the current driving state.
          */
         std::string m_drivingStateSubTitle;
+
+        /**
+         * @brief The current driving state.
+         */
+        Globals::DrivingState m_drivingState;
+
+        /**
+         * @brief The type of the lane line to the left of the vehicle.
+         */
+        Globals::LineTypes m_leftLineType;
+
+        /**
+         * @brief The type of the lane line to the right of the vehicle.
+         */
+        Globals::LineTypes m_rightLineType;
     };
 
     /**
@@ -94,6 +125,16 @@ namespace LaneAndObjectDetection
          * @brief The current number of frames per second.
          */
         double m_currentFramesPerSecond;
+
+        /**
+         * @brief The number of decoded frames waiting to be processed.
+         */
+        uint32_t m_frameReaderQueueDepth;
+
+        /**
+         * @brief The number of decoded frames that were dropped before being processed.
+         */
+        uint32_t m_frameReaderDroppedFrames;
     };
 
     /**
@@ -101,6 +142,12 @@ namespace LaneAndObjectDetection
      */
     struct VideoManagerInformation
     {
+        /**
+         * @brief The geometry of the input frames, which is derived from the resolution of the input video stream when it is
+         * opened.
+         */
+        FrameGeometry m_frameGeometry;
+
         /**
          * @brief Text to display whether or not the program is in debug mode.
          */
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class MemoryMappedFile
+     * @brief Maps a file read-only in to memory, so that it is paged in on demand rather than read through a stream, and the
+     * pages are shared with any other process mapping the same file.
+     */
+    class MemoryMappedFile
+    {
+    public:
+        /**
+         * @brief Constructs a new %MemoryMappedFile object.
+         */
+        explicit MemoryMappedFile();
+
+        /**
+         * @brief Destroys the %MemoryMappedFile object, unmapping the file.
+         */
+        ~MemoryMappedFile();
+
+        /**
+         * @brief Maps the file in to memory, unmapping any previously mapped file.
+         *
+         * @param p_filePath The file path of the file to map.
+         * @return true If the file was mapped.
+         * @return false If the file could not be opened or mapped, or is empty.
+         */
+        bool Open(const std::string& p_filePath);
+
+        /**
+         * @brief Unmaps the file.
+         */
+        void Close();
+
+        /**
+         * @brief Get the contents of the mapped file, which are only valid until the file is unmapped.
+         *
+         * @return `const char*` The contents of the mapped file or `nullptr` if no file is mapped.
+         */
+        const char* GetData();
+
+        /**
+         * @brief Get the size of the mapped file.
+         *
+         * @return `std::size_t` The size of the mapped file in bytes.
+         */
+        std::size_t GetSize();
+
+        /**
+         * @brief Disable constructing a new %MemoryMappedFile object using copy constructor.
+         *
+         * @param p_memoryMappedFile The %MemoryMappedFile to copy.
+         */
+        MemoryMappedFile(const MemoryMappedFile& p_memoryMappedFile) = delete;
+
+        /**
+         * @brief Disable constructing a new %MemoryMappedFile object using move constructor.
+         *
+         * @param p_memoryMappedFile The %MemoryMappedFile to copy.
+         */
+        MemoryMappedFile(const MemoryMappedFile&& p_memoryMappedFile) = delete;
+
+        /**
+         * @brief Disable constructing a new %MemoryMappedFile object using copy assignment operator.
+         *
+         * @param p_memoryMappedFile The %MemoryMappedFile to copy.
+         */
+        MemoryMappedFile& operator=(const MemoryMappedFile& p_memoryMappedFile) = delete;
+
+        /**
+         * @brief Disable constructing a new %MemoryMappedFile object using move assignment operator.
+         *
+         * @param p_memoryMappedFile The %MemoryMappedFile to copy.
+         */
+        MemoryMappedFile& operator=(const MemoryMappedFile&& p_memoryMappedFile) = delete;
+
+    private:
+        /**
+         * @brief The contents of the mapped file.
+         */
+        const char* m_data;
+
+        /**
+         * @brief The size of the mapped file in bytes.
+         */
+        std::size_t m_size;
+
+#ifdef _WIN32
+        /**
+         * @brief The handle of the file mapping object.
+         */
+        void* m_mappingHandle;
+#endif
+    };
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "helpers/MemoryMappedFile.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class ModelBundle
+     * @brief A single file containing the `.cfg` and `.weights` YOLO files of a Darknet model, which is memory-mapped when
+     * loaded so that both files are read with a single mapping rather than through streams. Bundles are written by the model
+     * converter, see `Globals::G_MODEL_BUNDLE_MAGIC` for the layout.
+     */
+    class ModelBundle
+    {
+    public:
+        /**
+         * @brief Constructs a new %ModelBundle object.
+         */
+        explicit ModelBundle();
+
+        /**
+         * @brief Maps the bundle in to memory and checks its header, closing any previously opened bundle.
+         *
+         * @param p_bundleFilePath The file path of the bundle.
+         * @return true If the bundle was mapped and is valid.
+         * @return false If the bundle could not be mapped, was written by another version or is truncated.
+         */
+        bool Open(const std::string& p_bundleFilePath);
+
+        /**
+         * @brief Unmaps the bundle.
+         */
+        void Close();
+
+        /**
+         * @brief Get the contents of the `.cfg` YOLO file, which are only valid until the bundle is closed.
+         *
+         * @return `const char*` The contents of the `.cfg` YOLO file.
+         */
+        const char* GetConfiguration();
+
+        /**
+         * @brief Get the size of the `.cfg` YOLO file.
+         *
+         * @return `std::size_t` The size of the `.cfg` YOLO file in bytes.
+         */
+        std::size_t GetConfigurationSize();
+
+        /**
+         * @brief Get the contents of the `.weights` YOLO file, which are only valid until the bundle is closed.
+         *
+         * @return `const char*` The contents of the `.weights` YOLO file.
+         */
+        const char* GetWeights();
+
+        /**
+         * @brief Get the size of the `.weights` YOLO file.
+         *
+         * @return `std::size_t` The size of the `.weights` YOLO file in bytes.
+         */
+        std::size_t GetWeightsSize();
+
+        /**
+         * @brief Writes a bundle containing the given `.cfg` and `.weights` YOLO files.
+         *
+         * @param p_configurationFilePath The file path of the `.cfg` YOLO file.
+         * @param p_weightsFilePath The file path of the `.weights` YOLO file.
+         * @param p_bundleFilePath The file path to write the bundle to.
+         * @return true If the bundle was written.
+         * @return false If either YOLO file could not be read or the bundle could not be written.
+         */
+        static bool Write(const std::string& p_configurationFilePath, const std::string& p_weightsFilePath, const std::string& p_bundleFilePath);
+
+        /**
+         * @brief Disable constructing a new %ModelBundle object using copy constructor.
+         *
+         * @param p_modelBundle The %ModelBundle to copy.
+         */
+        ModelBundle(const ModelBundle& p_modelBundle) = delete;
+
+        /**
+         * @brief Disable constructing a new %ModelBundle object using move constructor.
+         *
+         * @param p_modelBundle The %ModelBundle to copy.
+         */
+        ModelBundle(const ModelBundle&& p_modelBundle) = delete;
+
+        /**
+         * @brief Disable constructing a new %ModelBundle object using copy assignment operator.
+         *
+         * @param p_modelBundle The %ModelBundle to copy.
+         */
+        ModelBundle& operator=(const ModelBundle& p_modelBundle) = delete;
+
+        /**
+         * @brief Disable constructing a new %ModelBundle object using move assignment operator.
+         *
+         * @param p_modelBundle The %ModelBundle to copy.
+         */
+        ModelBundle& operator=(const ModelBundle&& p_modelBundle) = delete;
+
+    private:
+        /**
+         * @brief The memory-mapped bundle.
+         */
+        MemoryMappedFile m_bundleFile;
+
+        /**
+         * @brief The offset of the `.cfg` YOLO file within the bundle.
+         */
+        uint64_t m_configurationOffset;
+
+        /**
+         * @brief The size of the `.cfg` YOLO file.
+         */
+        uint64_t m_configurationSize;
+
+        /**
+         * @brief The offset of the `.weights` YOLO file within the bundle.
+         */
+        uint64_t m_weightsOffset;
+
+        /**
+         * @brief The size of the `.weights` YOLO file.
+         */
+        uint64_t m_weightsSize;
+    };
+}
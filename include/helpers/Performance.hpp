@@ -35,6 +35,22 @@ namespace LaneAndObjectDetection
          */
         void EndTimer();
 
+        /**
+         * @brief End the internal timer after processing `p_numberOfFrames` frames together (e.g. a batch), in which case the
+         * elapsed time is split evenly across each frame.
+         *
+         * @param p_numberOfFrames The number of frames processed since the internal timer was started.
+         */
+        void EndTimer(const uint32_t& p_numberOfFrames);
+
+        /**
+         * @brief Update the frame reader statistics.
+         *
+         * @param p_queueDepth The number of decoded frames waiting to be processed.
+         * @param p_droppedFrames The number of decoded frames that were dropped before being processed.
+         */
+        void UpdateFrameReaderStatistics(const uint32_t& p_queueDepth, const uint32_t& p_droppedFrames);
+
         /**
          * @brief Get the PerformanceInformation struct.
          *
@@ -49,6 +65,13 @@ namespace LaneAndObjectDetection
          */
         std::vector<uint32_t> GetFrameTimes();
 
+        /**
+         * @brief Get the time to compute the last frame.
+         *
+         * @return `uint32_t` The time to compute the last frame, or zero if no frames have been measured.
+         */
+        uint32_t GetLastFrameTime();
+
         /**
          * @brief Get the time unit for the frame times.
          *
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+
+#include "helpers/Globals.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class QualityController
+     * @brief Closed-loop controller which steps the object detector between the quality levels of
+     * `Globals::G_QUALITY_CONTROLLER_OBJECT_DETECTOR_TYPES` and `Globals::G_QUALITY_CONTROLLER_BLOB_SIZES` to hold a target
+     * frames per second. The controller only requests a level, the caller confirms it with `SetLevel()` once the network for
+     * that level is ready so that the current level keeps running in the meantime.
+     */
+    class QualityController
+    {
+    public:
+        /**
+         * @brief Construct a new %QualityController object, which is disabled until a target is set.
+         */
+        explicit QualityController();
+
+        /**
+         * @brief Set the frames per second that the controller holds the frame time to.
+         *
+         * @param p_targetFramesPerSecond The target frames per second or `Globals::G_QUALITY_CONTROLLER_DISABLED`.
+         */
+        void SetTargetFramesPerSecond(const double& p_targetFramesPerSecond);
+
+        /**
+         * @brief Start the controller from the level that is closest to the given object detector, discarding all previous
+         * frame times.
+         *
+         * @param p_objectDetectorTypes The type of object detector currently in use.
+         * @param p_objectDetectorBlobSizes The blob size currently in use.
+         */
+        void SetStartingLevel(const Globals::ObjectDetectorTypes& p_objectDetectorTypes, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
+
+        /**
+         * @brief Confirm that the object detector has switched to `p_level`, which starts the cooldown.
+         *
+         * @param p_level The quality level now in use.
+         */
+        void SetLevel(const uint32_t& p_level);
+
+        /**
+         * @brief Update the average frame time and request a new level if it has stayed outside of the budget.
+         *
+         * @param p_frameTime The time to compute the last frame, in the units of `Performance::GetTimeUnit()`.
+         */
+        void Update(const uint32_t& p_frameTime);
+
+        /**
+         * @brief Get whether a target frames per second has been set.
+         *
+         * @return true If the controller is enabled.
+         * @return false If the controller is disabled.
+         */
+        bool IsEnabled();
+
+        /**
+         * @brief Get the quality level currently in use.
+         *
+         * @return `uint32_t` The quality level currently in use.
+         */
+        uint32_t GetLevel();
+
+        /**
+         * @brief Get the quality level that the controller wants to switch to, which is the current level if no switch is
+         * needed.
+         *
+         * @return `uint32_t` The requested quality level.
+         */
+        uint32_t GetRequestedLevel();
+
+        /**
+         * @brief Get the quality level that is most likely to be requested next, so that its network can be loaded before it
+         * is needed.
+         *
+         * @return `uint32_t` The quality level to preload.
+         */
+        uint32_t GetPreloadLevel();
+
+    private:
+        /**
+         * @brief The frame time budget, or zero when disabled.
+         */
+        double m_targetFrameTime;
+
+        /**
+         * @brief The exponential moving average of the frame times, or zero before the first frame.
+         */
+        double m_averageFrameTime;
+
+        /**
+         * @brief The quality level currently in use.
+         */
+        uint32_t m_level;
+
+        /**
+         * @brief The quality level that the controller wants to switch to.
+         */
+        uint32_t m_requestedLevel;
+
+        /**
+         * @brief The number of frames in a row that the average frame time has been over the budget.
+         */
+        uint32_t m_framesOverBudget;
+
+        /**
+         * @brief The number of frames in a row that the average frame time has been under the budget.
+         */
+        uint32_t m_framesUnderBudget;
+
+        /**
+         * @brief The number of frames since the level was last changed.
+         */
+        uint32_t m_framesSinceLevelChange;
+
+        /**
+         * @brief The level that was last lowered from, which cannot be returned to until the backoff has elapsed.
+         */
+        uint32_t m_upgradeBackoffLevel;
+
+        /**
+         * @brief The number of frames left before `m_upgradeBackoffLevel` can be returned to.
+         */
+        uint32_t m_upgradeBackoffFrames;
+    };
+}
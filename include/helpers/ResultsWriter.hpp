@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+#include "helpers/Globals.hpp"
+#include "helpers/Information.hpp"
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class ResultsWriter
+     * @brief Streams the object and lane detection information of every frame to a file or standard output so that downstream
+     * systems can consume the detections without decoding the output video.
+     *
+     * The JSON Lines format writes one object per frame:
+     *
+     *   {"frame":0,"objects":[{"classId":2,"name":"car","confidence":0.8731,"boundingBox":[x,y,w,h]}],
+     *    "lane":{"drivingState":0,"leftLineType":2,"rightLineType":1,"overlayCorners":[[x,y],[x,y],[x,y],[x,y]]}}
+     *
+     * The binary format starts with `Globals::G_RESULTS_BINARY_MAGIC` and `Globals::G_RESULTS_BINARY_VERSION` (uint32)
+     * followed by one record per frame, where all values are in host byte order:
+     *
+     *   uint32 frame, uint8 drivingState, uint8 leftLineType, uint8 rightLineType, uint8 padding, int32[8] overlayCorners,
+     *   uint32 numberOfObjects, then per object: uint32 classId, float32 confidence, int32[4] boundingBox
+     *
+     * The driving state and line types are the values of `Globals::DrivingState` and `Globals::LineTypes`.
+     */
+    class ResultsWriter
+    {
+    public:
+        /**
+         * @brief Constructs a new %ResultsWriter object.
+         */
+        explicit ResultsWriter();
+
+        /**
+         * @brief Opens the results stream, closing any previously opened stream.
+         *
+         * @param p_resultsFilePath The file path to write the results to or "-" to write them to standard output.
+         * @param p_resultsFormat The format to write the results in.
+         * @return true If the results stream was opened.
+         * @return false If the results file could not be opened.
+         */
+        bool Open(const std::string& p_resultsFilePath, const Globals::ResultsFormats& p_resultsFormat);
+
+        /**
+         * @brief Writes the results of the next frame.
+         *
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing all object detection-related
+         * information.
+         * @param p_laneDetectionInformation The LaneDetectionInformation struct containing all lane detection-related
+         * information.
+         */
+        void Write(const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation);
+
+        /**
+         * @brief Flushes and closes the results stream.
+         */
+        void Close();
+
+        /**
+         * @brief Get whether the results stream is open.
+         *
+         * @return true If the results stream is open.
+         * @return false If the results stream is not open.
+         */
+        bool IsOpen();
+
+        /**
+         * @brief Disable constructing a new %ResultsWriter object using copy constructor.
+         *
+         * @param p_resultsWriter The %ResultsWriter to copy.
+         */
+        ResultsWriter(const ResultsWriter& p_resultsWriter) = delete;
+
+        /**
+         * @brief Disable constructing a new %ResultsWriter object using move constructor.
+         *
+         * @param p_resultsWriter The %ResultsWriter to copy.
+         */
+        ResultsWriter(const ResultsWriter&& p_resultsWriter) = delete;
+
+        /**
+         * @brief Disable constructing a new %ResultsWriter object using copy assignment operator.
+         *
+         * @param p_resultsWriter The %ResultsWriter to copy.
+         */
+        ResultsWriter& operator=(const ResultsWriter& p_resultsWriter) = delete;
+
+        /**
+         * @brief Disable constructing a new %ResultsWriter object using move assignment operator.
+         *
+         * @param p_resultsWriter The %ResultsWriter to copy.
+         */
+        ResultsWriter& operator=(const ResultsWriter&& p_resultsWriter) = delete;
+
+    private:
+        /**
+         * @brief Appends the results of the current frame to `m_record` as a single line of JSON.
+         *
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing all object detection-related
+         * information.
+         * @param p_laneDetectionInformation The LaneDetectionInformation struct containing all lane detection-related
+         * information.
+         */
+        void BuildJsonLinesRecord(const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation);
+
+        /**
+         * @brief Appends the results of the current frame to `m_record` as a binary record.
+         *
+         * @param p_objectDetectionInformation The ObjectDetectionInformation struct containing all object detection-related
+         * information.
+         * @param p_laneDetectionInformation The LaneDetectionInformation struct containing all lane detection-related
+         * information.
+         */
+        void BuildBinaryRecord(const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation);
+
+        /**
+         * @brief Appends the raw bytes of `p_value` to `m_record`.
+         *
+         * @tparam T The trivially copyable type of the value.
+         * @param p_value The value to append.
+         */
+        template<typename T>
+        void AppendBinary(const T& p_value);
+
+        /**
+         * @brief The results file when not writing to standard output.
+         */
+        std::ofstream m_resultsFile;
+
+        /**
+         * @brief The results record of the current frame, which is reused across frames to avoid reallocating.
+         */
+        std::string m_record;
+
+        /**
+         * @brief The stream being written to, which is either `m_resultsFile` or standard output.
+         */
+        std::ostream* m_outputStream;
+
+        /**
+         * @brief The format to write the results in.
+         */
+        Globals::ResultsFormats m_resultsFormat;
+
+        /**
+         * @brief The number of the next frame to be written.
+         */
+        uint32_t m_frameNumber;
+
+        /**
+         * @brief Whether the results are being written to standard output, in which case each frame is flushed so that
+         * downstream consumers receive it immediately.
+         */
+        bool m_writingToStandardOutput;
+    };
+}
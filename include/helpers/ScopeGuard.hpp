@@ -0,0 +1,71 @@
+#pragma once
+
+#include <utility>
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class ScopeGuard
+     * @brief Calls a function when it goes out of scope, including when the scope is left by an exception.
+     * @tparam F The type of the function to call, which must not throw.
+     */
+    template<typename F>
+    class ScopeGuard
+    {
+    public:
+        /**
+         * @brief Constructs a new %ScopeGuard object.
+         *
+         * @param p_function The function to call when the %ScopeGuard goes out of scope.
+         */
+        explicit ScopeGuard(F p_function) :
+            m_function(std::move(p_function))
+        {}
+
+        /**
+         * @brief Destructs a %ScopeGuard object, calling its function.
+         */
+        ~ScopeGuard()
+        {
+            m_function();
+        }
+
+        /**
+         * @brief Disable constructing a new %ScopeGuard object using copy constructor.
+         *
+         * @param p_scopeGuard The %ScopeGuard to copy.
+         */
+        ScopeGuard(const ScopeGuard& p_scopeGuard) = delete;
+
+        /**
+         * @brief Disable constructing a new %ScopeGuard object using move constructor.
+         *
+         * @param p_scopeGuard The %ScopeGuard to copy.
+         */
+        ScopeGuard(const ScopeGuard&& p_scopeGuard) = delete;
+
+        /**
+         * @brief Disable constructing a new %ScopeGuard object using copy assignment operator.
+         *
+         * @param p_scopeGuard The %ScopeGuard to copy.
+         */
+        ScopeGuard& operator=(const ScopeGuard& p_scopeGuard) = delete;
+
+        /**
+         * @brief Disable constructing a new %ScopeGuard object using move assignment operator.
+         *
+         * @param p_scopeGuard The %ScopeGuard to copy.
+         */
+        ScopeGuard& operator=(const ScopeGuard&& p_scopeGuard) = delete;
+
+    private:
+        /**
+         * @brief The function to call when the %ScopeGuard goes out of scope.
+         */
+        F m_function;
+    };
+}
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -10,9 +11,13 @@
 
 #include "detectors/LaneDetector.hpp"
 #include "detectors/ObjectDetector.hpp"
+#include "helpers/DebugVisualiser.hpp"
+#include "helpers/FrameReader.hpp"
 #include "helpers/Globals.hpp"
 #include "helpers/Information.hpp"
 #include "helpers/Performance.hpp"
+#include "helpers/QualityController.hpp"
+#include "helpers/ResultsWriter.hpp"
 
 /**
  * @namespace LaneAndObjectDetection
@@ -91,8 +96,19 @@ namespace LaneAndObjectDetection
          * Optional options:
          *
          *   -o --object-detector-type       One of: none, standard or tiny. (default = none)
-         *   -b --object-detector-backend    One of: cpu or cuda (default = cpu)
+         *   -b --object-detector-backend    One of: cpu, gpu, cuda, cpu-fp16 or cpu-int8 (default = cpu)
          *   -s --object-detector-blob-size  One of: 208, 320, 416, 512 or 608 (default = 208)
+         *   -n --object-detector-batch-size Number of frames per forward pass in sequential mode (default = 1)
+         *   -d --object-detector-interval   Run the object detector every N frames or adaptive (default = 1)
+         *   -c --horizon-crop               Also run the object detector on a crop around the horizon for distant objects
+         *   -t --target-fps                 Switch the object detector type and blob size to hold a target FPS (default = none)
+         *   -l --lane-detector-scale        One of: full, half or quarter (default = full)
+         *   -m --processing-mode            One of: sequential, concurrent or pipelined (default = sequential)
+         *   -f --frame-reader-policy        One of: block or drop-oldest (default = block)
+         *   -w --output-video-file-path     File path to record the output video to from the first frame (default = none)
+         *   -H --headless                   Run without any windows or keyboard input
+         *   -r --results-file-path          File path to stream per-frame results to or - for stdout (default = none)
+         *   -e --results-format             One of: json-lines or binary (default = json-lines)
          *
          * @param p_commandLineArguments List of all command line arguments.
          */
@@ -141,6 +157,94 @@ namespace LaneAndObjectDetection
                            const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
                            const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes);
 
+        /**
+         * @brief Set how frames are processed by `RunLaneAndObjectDetector()`.
+         *
+         * @param p_processingMode Sequential mode runs every stage one after another on a single thread. Concurrent mode runs
+         * the lane detector front-end alongside the object detector on the same frame. Pipelined mode runs
+         * each stage on its own thread connected by bounded queues, so that throughput approaches the speed of the slowest
+         * stage rather than the sum of all stages.
+         */
+        void SetProcessingMode(const Globals::ProcessingModes& p_processingMode);
+
+        /**
+         * @brief Set what the frame reader does when its ring buffer of decoded frames is full.
+         *
+         * @param p_frameReaderPolicy `BLOCK` waits for a free buffer so that no frames are lost (suited to video files) while
+         * `DROP_OLDEST` overwrites the oldest decoded frame so that the newest frame is always processed (suited to live
+         * cameras).
+         */
+        void SetFrameReaderPolicy(const Globals::FrameReaderPolicies& p_frameReaderPolicy);
+
+        /**
+         * @brief Set whether to run without any windows or keyboard input, in which case frames are processed as fast as
+         * possible and the output frame is only built when it is being recorded. Results can still be streamed using
+         * `SetResultsOutput()`.
+         *
+         * @param p_headless Whether to run headless.
+         */
+        void SetHeadless(const bool& p_headless);
+
+        /**
+         * @brief Set the file path that the output video is recorded to. When set, recording starts from the first frame
+         * processed by `RunLaneAndObjectDetector()` rather than a timestamped file being created when recording is toggled.
+         *
+         * @param p_outputVideoFilePath The file path of the output video or an empty string to use a timestamped file name.
+         */
+        void SetOutputVideoFilePath(const std::string& p_outputVideoFilePath);
+
+        /**
+         * @brief Set where the object and lane detection information of every frame is streamed to by
+         * `RunLaneAndObjectDetector()`.
+         *
+         * @param p_resultsFilePath The file path to write the results to, "-" to write them to standard output or an empty
+         * string to not write any results.
+         * @param p_resultsFormat The format to write the results in.
+         */
+        void SetResultsOutput(const std::string& p_resultsFilePath, const Globals::ResultsFormats& p_resultsFormat);
+
+        /**
+         * @brief Set the number of frames that are run through the object detector in a single forward pass. Batching is
+         * intended for offline processing as every frame in a batch must be decoded before any of them are output, so is only
+         * used in sequential mode.
+         *
+         * @param p_objectDetectorBatchSize The number of frames per forward pass where 1 disables batching.
+         */
+        void SetObjectDetectorBatchSize(const uint32_t& p_objectDetectorBatchSize);
+
+        /**
+         * @brief Set how often the object detector is run, with the detected objects propagated by a tracker on the frames in
+         * between. Not used when batching, as every frame in a batch is detected.
+         *
+         * @param p_objectDetectorInterval The number of frames between each detection, where 1 detects every frame and
+         * `Globals::G_OBJECT_DETECTOR_ADAPTIVE_INTERVAL` adapts the interval to how well the tracker predicts the detections.
+         */
+        void SetObjectDetectorInterval(const uint32_t& p_objectDetectorInterval);
+
+        /**
+         * @brief Set whether the object detector also runs on a crop around the horizon, merging its detections with those of
+         * the full frame, so that distant vehicles are found at the lower blob sizes. Not used when batching.
+         *
+         * @param p_horizonCrop Whether to run the object detector on the horizon crop.
+         */
+        void SetObjectDetectorHorizonCrop(const bool& p_horizonCrop);
+
+        /**
+         * @brief Set the frames per second that the object detector type and blob size are adjusted to hold, starting from
+         * those passed to `SetProperties()`. Not used when batching or in pipelined mode, where the object detector does not
+         * run on the thread that measures the frame times.
+         *
+         * @param p_targetFramesPerSecond The target frames per second or `Globals::G_QUALITY_CONTROLLER_DISABLED`.
+         */
+        void SetTargetFramesPerSecond(const double& p_targetFramesPerSecond);
+
+        /**
+         * @brief Set the resolution that the lane detector processes the region-of-interest at.
+         *
+         * @param p_laneDetectorScale The factor that the region-of-interest is downscaled by.
+         */
+        void SetLaneDetectorScale(const Globals::LaneDetectorScales& p_laneDetectorScale);
+
         /**
          * @brief Orchestration function which contains the main program loop.
          */
@@ -182,6 +286,75 @@ namespace LaneAndObjectDetection
         VideoManager& operator=(const VideoManager&& p_videoManager) = delete;
 
     private:
+        /**
+         * @brief A frame and its associated detection information as it moves through the pipeline stages.
+         */
+        struct PipelineFrame
+        {
+            /**
+             * @brief The frame being processed.
+             */
+            cv::Mat m_frame;
+
+            /**
+             * @brief An immutable snapshot of the object detection information for `m_frame`.
+             */
+            std::shared_ptr<const ObjectDetectionInformation> m_objectDetectionInformation;
+
+            /**
+             * @brief An immutable snapshot of the lane detection information for `m_frame`.
+             */
+            std::shared_ptr<const LaneDetectionInformation> m_laneDetectionInformation;
+        };
+
+        /**
+         * @brief Runs every stage one after another on the calling thread, except in concurrent mode where the lane detector
+         * front-end runs on a second thread alongside the object detector.
+         */
+        void RunSequentially();
+
+        /**
+         * @brief Runs the object detector against batches of frames on the calling thread, followed by the lane detector and
+         * output of each frame in the batch in order.
+         */
+        void RunBatched();
+
+        /**
+         * @brief Runs object detection and lane detection on their own threads, fed by the frame reader thread and connected
+         * by bounded queues, while the output stage runs on the calling thread (as HighGUI must be used from a single thread).
+         * The detection information is passed between stages as immutable snapshots so that it is never copied.
+         */
+        void RunPipelined();
+
+        /**
+         * @brief Updates `p_frame` with the detection information and then saves and displays it.
+         *
+         * @param p_frame The frame to output.
+         * @param p_objectDetectionInformation The object detection information for `p_frame`.
+         * @param p_laneDetectionInformation The lane detection information for `p_frame`.
+         */
+        void OutputFrame(cv::Mat& p_frame, const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation);
+
+        /**
+         * @brief Handles any key pressed by the user.
+         *
+         * @return true If processing should continue.
+         * @return false If the user has requested to quit.
+         */
+        bool HandleUserInput();
+
+        /**
+         * @brief Derives the frame geometry from the resolution of the newly opened input video stream and passes it to the
+         * lane detector.
+         */
+        void UpdateFrameGeometry();
+
+        /**
+         * @brief Feeds the last frame time to the quality controller, switching the object detector to the requested level
+         * once its network is ready and otherwise preloading the level most likely to be requested next.
+         */
+        void UpdateObjectDetectorQuality();
+
         /**
          * @brief Toggles the debug mode and whether to destroy the debug frames.
          */
@@ -199,9 +372,9 @@ namespace LaneAndObjectDetection
         void Quit();
 
         /**
-         * @brief Represents the input video stream.
+         * @brief Decodes the input video stream on a dedicated thread.
          */
-        cv::VideoCapture m_inputVideo;
+        FrameReader m_frameReader;
 
         /**
          * @brief Represents the output video stream.
@@ -213,6 +386,11 @@ namespace LaneAndObjectDetection
          */
         cv::Mat m_currentFrame;
 
+        /**
+         * @brief Renders and displays the lane detector debug frames in debug mode.
+         */
+        DebugVisualiser m_debugVisualiser;
+
         /**
          * @brief The lane detector.
          */
@@ -228,6 +406,11 @@ namespace LaneAndObjectDetection
          */
         Performance m_performance;
 
+        /**
+         * @brief Adjusts the object detector type and blob size to hold the target frames per second.
+         */
+        QualityController m_qualityController;
+
         /**
          * @brief The VideoManagerInformation struct containing all video manager-related information.
          */
@@ -237,5 +420,40 @@ namespace LaneAndObjectDetection
          * @brief The time that the output started to be saved locally.
          */
         std::chrono::time_point<std::chrono::high_resolution_clock> m_saveOutputStartTime;
+
+        /**
+         * @brief The file path that the output video is recorded to or an empty string to use a timestamped file name.
+         */
+        std::string m_outputVideoFilePath;
+
+        /**
+         * @brief Streams the object and lane detection information of every frame.
+         */
+        ResultsWriter m_resultsWriter;
+
+        /**
+         * @brief The file path that the results are written to, "-" for standard output or an empty string for no results.
+         */
+        std::string m_resultsFilePath;
+
+        /**
+         * @brief How frames are processed by `RunLaneAndObjectDetector()`.
+         */
+        Globals::ProcessingModes m_processingMode;
+
+        /**
+         * @brief The format the results are written in.
+         */
+        Globals::ResultsFormats m_resultsFormat;
+
+        /**
+         * @brief The number of frames run through the object detector in a single forward pass.
+         */
+        uint32_t m_objectDetectorBatchSize;
+
+        /**
+         * @brief Whether running without any windows or keyboard input.
+         */
+        bool m_headless;
     };
 }
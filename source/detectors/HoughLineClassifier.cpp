@@ -0,0 +1,297 @@
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/core/matx.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "detectors/ObjectOccupancyMask.hpp"
+#include "helpers/Globals.hpp"
+
+#include "detectors/HoughLineClassifier.hpp"
+
+namespace
+{
+    /**
+     * @brief The buffer given to the edges of the mask.
+     */
+    const double EDGE_OF_MASK_BUFFER = 1;
+}
+
+namespace LaneAndObjectDetection
+{
+    HoughLineClassifier::HoughLineClassifier() :
+        m_leftLineTotalLength(0),
+        m_middleLineTotalLength(0),
+        m_rightLineTotalLength(0)
+    {
+        m_x1.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_y1.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_x2.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_y2.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_lengths.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_geometricLineTypes.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_lineTypes.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_leftLineIndices.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_middleLineIndices.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+        m_rightLineIndices.reserve(Globals::G_HOUGH_LINE_CLASSIFIER_INITIAL_CAPACITY);
+    }
+
+    void HoughLineClassifier::Run(const std::vector<cv::Vec4i>& p_houghLines, ObjectOccupancyMask& p_objectOccupancyMask)
+    {
+        const int32_t NUMBER_OF_LINES = static_cast<int32_t>(p_houghLines.size());
+
+        m_x1.resize(NUMBER_OF_LINES);
+        m_y1.resize(NUMBER_OF_LINES);
+        m_x2.resize(NUMBER_OF_LINES);
+        m_y2.resize(NUMBER_OF_LINES);
+        m_lengths.resize(NUMBER_OF_LINES);
+        m_geometricLineTypes.resize(NUMBER_OF_LINES);
+        m_lineTypes.resize(NUMBER_OF_LINES);
+
+        for (int32_t i = 0; i < NUMBER_OF_LINES; i++)
+        {
+            m_x1[i] = static_cast<float>(p_houghLines[i][Globals::G_VEC4_X1_INDEX]);
+            m_y1[i] = static_cast<float>(p_houghLines[i][Globals::G_VEC4_Y1_INDEX]);
+            m_x2[i] = static_cast<float>(p_houghLines[i][Globals::G_VEC4_X2_INDEX]);
+            m_y2[i] = static_cast<float>(p_houghLines[i][Globals::G_VEC4_Y2_INDEX]);
+        }
+
+        int32_t index = 0;
+
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+        const int32_t NUMBER_OF_LANES = cv::VTraits<cv::v_float32>::vlanes();
+        const cv::v_float32 ZEROS = cv::vx_setzero_f32();
+        const cv::v_float64 DOUBLE_ZEROS = cv::vx_setall_f64(0);
+        const cv::v_float64 HORIZONTAL_GRADIENT_THRESHOLDS = cv::vx_setall_f64(Globals::G_HOUGH_LINE_HORIZONTAL_GRADIENT_THRESHOLD);
+
+        // The co-ordinates are exact in single precision, but the gradients and line equations are evaluated in double
+        // precision so that lines exactly on a threshold are classified the same as by `ClassifyLine()`. Each half of the
+        // lanes is compared separately and the masks are packed back to the width of a float lane.
+        const auto PACK = [](const cv::v_float64& p_lowMask, const cv::v_float64& p_highMask) {
+            return cv::v_reinterpret_as_f32(cv::v_pack(cv::v_reinterpret_as_u64(p_lowMask), cv::v_reinterpret_as_u64(p_highMask)));
+        };
+
+        // Whether both ends of the lines are below the line `y = mx + c + buffer`, or also on it if `p_isInclusive`
+        const auto IS_BELOW_LINE = [&PACK](const cv::v_float32& p_x1, const cv::v_float32& p_y1, const cv::v_float32& p_x2, const cv::v_float32& p_y2, const double& p_m, const double& p_c, const double& p_buffer, const bool& p_isInclusive) {
+            const cv::v_float64 M = cv::vx_setall_f64(p_m);
+            const cv::v_float64 C = cv::vx_setall_f64(p_c);
+            const cv::v_float64 BUFFER = cv::vx_setall_f64(p_buffer);
+
+            const auto IS_BELOW = [&](const cv::v_float64& p_x, const cv::v_float64& p_y) {
+                const cv::v_float64 LINE_Y = cv::v_add(cv::v_add(cv::v_mul(M, p_x), C), BUFFER);
+                return p_isInclusive ? cv::v_le(p_y, LINE_Y) : cv::v_lt(p_y, LINE_Y);
+            };
+
+            const cv::v_float32 IS_FIRST_END_BELOW = PACK(IS_BELOW(cv::v_cvt_f64(p_x1), cv::v_cvt_f64(p_y1)), IS_BELOW(cv::v_cvt_f64_high(p_x1), cv::v_cvt_f64_high(p_y1)));
+            const cv::v_float32 IS_SECOND_END_BELOW = PACK(IS_BELOW(cv::v_cvt_f64(p_x2), cv::v_cvt_f64(p_y2)), IS_BELOW(cv::v_cvt_f64_high(p_x2), cv::v_cvt_f64_high(p_y2)));
+
+            return cv::v_and(IS_FIRST_END_BELOW, IS_SECOND_END_BELOW);
+        };
+
+        // Each check overwrites the type given by the checks made after it, so they are applied in reverse
+        const auto APPLY = [](const cv::v_float32& p_mask, const Globals::HoughLineTypes& p_houghLineType, const cv::v_int32& p_lineTypes) {
+            return cv::v_select(cv::v_reinterpret_as_s32(p_mask), cv::vx_setall_s32(static_cast<int32_t>(p_houghLineType)), p_lineTypes);
+        };
+
+        for (; index <= NUMBER_OF_LINES - NUMBER_OF_LANES; index += NUMBER_OF_LANES)
+        {
+            const cv::v_float32 X1 = cv::vx_load(m_x1.data() + index);
+            const cv::v_float32 Y1 = cv::vx_load(m_y1.data() + index);
+            const cv::v_float32 X2 = cv::vx_load(m_x2.data() + index);
+            const cv::v_float32 Y2 = cv::vx_load(m_y2.data() + index);
+            const cv::v_float32 CHANGE_IN_X = cv::v_sub(X1, X2);
+            const cv::v_float32 CHANGE_IN_Y = cv::v_sub(Y1, Y2);
+
+            // The gradients of vertical lines are not finite, but those lines are classified as vertical last
+            const cv::v_float64 LOW_GRADIENTS = cv::v_div(cv::v_cvt_f64(CHANGE_IN_Y), cv::v_cvt_f64(CHANGE_IN_X));
+            const cv::v_float64 HIGH_GRADIENTS = cv::v_div(cv::v_cvt_f64_high(CHANGE_IN_Y), cv::v_cvt_f64_high(CHANGE_IN_X));
+            const cv::v_float32 IS_NEGATIVE_GRADIENT = PACK(cv::v_lt(LOW_GRADIENTS, DOUBLE_ZEROS), cv::v_lt(HIGH_GRADIENTS, DOUBLE_ZEROS));
+            const cv::v_float32 IS_POSITIVE_GRADIENT = PACK(cv::v_gt(LOW_GRADIENTS, DOUBLE_ZEROS), cv::v_gt(HIGH_GRADIENTS, DOUBLE_ZEROS));
+
+            const cv::v_float32 IS_VERTICAL = cv::v_eq(CHANGE_IN_X, ZEROS);
+            const cv::v_float32 IS_HORIZONTAL = PACK(cv::v_lt(cv::v_abs(LOW_GRADIENTS), HORIZONTAL_GRADIENT_THRESHOLDS), cv::v_lt(cv::v_abs(HIGH_GRADIENTS), HORIZONTAL_GRADIENT_THRESHOLDS));
+            const cv::v_float32 IS_LEFT_EDGE = IS_BELOW_LINE(X1, Y1, X2, Y2, Globals::G_LEFT_EDGE_OF_MASK_M, Globals::G_LEFT_EDGE_OF_MASK_C, EDGE_OF_MASK_BUFFER, true);
+            const cv::v_float32 IS_LEFT = cv::v_and(IS_BELOW_LINE(X1, Y1, X2, Y2, Globals::G_LEFT_LINE_THRESHOLD_M, Globals::G_LEFT_LINE_THRESHOLD_C, 0, false), IS_NEGATIVE_GRADIENT);
+            const cv::v_float32 IS_RIGHT_EDGE = IS_BELOW_LINE(X1, Y1, X2, Y2, Globals::G_RIGHT_EDGE_OF_MASK_M, Globals::G_RIGHT_EDGE_OF_MASK_C, EDGE_OF_MASK_BUFFER, true);
+            const cv::v_float32 IS_RIGHT = cv::v_and(IS_BELOW_LINE(X1, Y1, X2, Y2, Globals::G_RIGHT_LINE_THRESHOLD_M, Globals::G_RIGHT_LINE_THRESHOLD_C, 0, false), IS_POSITIVE_GRADIENT);
+
+            cv::v_int32 lineTypes = cv::vx_setall_s32(static_cast<int32_t>(Globals::HoughLineTypes::MIDDLE));
+            lineTypes = APPLY(IS_RIGHT, Globals::HoughLineTypes::RIGHT, lineTypes);
+            lineTypes = APPLY(IS_RIGHT_EDGE, Globals::HoughLineTypes::RIGHT_EDGE, lineTypes);
+            lineTypes = APPLY(IS_LEFT, Globals::HoughLineTypes::LEFT, lineTypes);
+            lineTypes = APPLY(IS_LEFT_EDGE, Globals::HoughLineTypes::LEFT_EDGE, lineTypes);
+            lineTypes = APPLY(IS_HORIZONTAL, Globals::HoughLineTypes::HORIZONTAL, lineTypes);
+            lineTypes = APPLY(IS_VERTICAL, Globals::HoughLineTypes::VERTICAL, lineTypes);
+
+            cv::v_store(m_geometricLineTypes.data() + index, lineTypes);
+            cv::v_store(m_lengths.data() + index, cv::v_sqrt(cv::v_add(cv::v_mul(CHANGE_IN_X, CHANGE_IN_X), cv::v_mul(CHANGE_IN_Y, CHANGE_IN_Y))));
+        }
+#endif
+
+        // Scalar tail (or every line when SIMD is not available)
+        for (; index < NUMBER_OF_LINES; index++)
+        {
+            const float CHANGE_IN_X = m_x1[index] - m_x2[index];
+            const float CHANGE_IN_Y = m_y1[index] - m_y2[index];
+
+            m_geometricLineTypes[index] = static_cast<int32_t>(ClassifyLine(m_x1[index], m_y1[index], m_x2[index], m_y2[index]));
+            m_lengths[index] = std::sqrt((CHANGE_IN_X * CHANGE_IN_X) + (CHANGE_IN_Y * CHANGE_IN_Y));
+        }
+
+        m_leftLineIndices.clear();
+        m_middleLineIndices.clear();
+        m_rightLineIndices.clear();
+        m_leftLineTotalLength = 0;
+        m_middleLineTotalLength = 0;
+        m_rightLineTotalLength = 0;
+
+        for (int32_t i = 0; i < NUMBER_OF_LINES; i++)
+        {
+            Globals::HoughLineTypes lineType = static_cast<Globals::HoughLineTypes>(m_geometricLineTypes[i]);
+
+            // The bounding boxes are created by the object detector which cannot detect road markings. Thus, if the line is in
+            // a bounding box, it cannot be a road marking and is ignored. This check is made after the vertical and horizontal
+            // checks, so only lines that passed those are looked up.
+            if (lineType != Globals::HoughLineTypes::VERTICAL && lineType != Globals::HoughLineTypes::HORIZONTAL &&
+                (p_objectOccupancyMask.IsOccupied(cv::Point(p_houghLines[i][Globals::G_VEC4_X1_INDEX], p_houghLines[i][Globals::G_VEC4_Y1_INDEX])) ||
+                 p_objectOccupancyMask.IsOccupied(cv::Point(p_houghLines[i][Globals::G_VEC4_X2_INDEX], p_houghLines[i][Globals::G_VEC4_Y2_INDEX]))))
+            {
+                lineType = Globals::HoughLineTypes::WITHIN_OBJECT;
+            }
+
+            m_lineTypes[i] = lineType;
+
+            switch (lineType)
+            {
+            case Globals::HoughLineTypes::LEFT:
+                m_leftLineIndices.push_back(static_cast<uint32_t>(i));
+                m_leftLineTotalLength += m_lengths[i];
+                break;
+
+            case Globals::HoughLineTypes::MIDDLE:
+                m_middleLineIndices.push_back(static_cast<uint32_t>(i));
+                m_middleLineTotalLength += m_lengths[i];
+                break;
+
+            case Globals::HoughLineTypes::RIGHT:
+                m_rightLineIndices.push_back(static_cast<uint32_t>(i));
+                m_rightLineTotalLength += m_lengths[i];
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    const std::vector<Globals::HoughLineTypes>& HoughLineClassifier::GetLineTypes()
+    {
+        return m_lineTypes;
+    }
+
+    const std::vector<uint32_t>& HoughLineClassifier::GetLeftLineIndices()
+    {
+        return m_leftLineIndices;
+    }
+
+    const std::vector<uint32_t>& HoughLineClassifier::GetMiddleLineIndices()
+    {
+        return m_middleLineIndices;
+    }
+
+    const std::vector<uint32_t>& HoughLineClassifier::GetRightLineIndices()
+    {
+        return m_rightLineIndices;
+    }
+
+    double HoughLineClassifier::GetLeftLineAverageLength()
+    {
+        return m_leftLineTotalLength / static_cast<double>(m_leftLineIndices.size());
+    }
+
+    double HoughLineClassifier::GetMiddleLineAverageLength()
+    {
+        return m_middleLineTotalLength / static_cast<double>(m_middleLineIndices.size());
+    }
+
+    double HoughLineClassifier::GetRightLineAverageLength()
+    {
+        return m_rightLineTotalLength / static_cast<double>(m_rightLineIndices.size());
+    }
+
+    Globals::HoughLineTypes HoughLineClassifier::ClassifyLine(const float& p_x1, const float& p_y1, const float& p_x2, const float& p_y2)
+    {
+        const double CHANGE_IN_X = static_cast<double>(p_x1) - p_x2;
+        const double CHANGE_IN_Y = static_cast<double>(p_y1) - p_y2;
+
+        if (CHANGE_IN_X == 0)
+        {
+            return Globals::HoughLineTypes::VERTICAL;
+        }
+
+        const double GRADIENT = CHANGE_IN_Y / CHANGE_IN_X;
+
+        if (std::fabs(GRADIENT) < Globals::G_HOUGH_LINE_HORIZONTAL_GRADIENT_THRESHOLD)
+        {
+            return Globals::HoughLineTypes::HORIZONTAL;
+        }
+
+        // Whether both ends of the line are below the line `y = mx + c + buffer`, or also on it if `p_isInclusive`
+        const auto IS_BELOW_LINE = [&](const double& p_m, const double& p_c, const double& p_buffer, const bool& p_isInclusive) {
+            const double FIRST_LINE_Y = (p_m * p_x1) + p_c + p_buffer;
+            const double SECOND_LINE_Y = (p_m * p_x2) + p_c + p_buffer;
+
+            return p_isInclusive ? (p_y1 <= FIRST_LINE_Y && p_y2 <= SECOND_LINE_Y) : (p_y1 < FIRST_LINE_Y && p_y2 < SECOND_LINE_Y);
+        };
+
+        // ROI frame:
+        //
+        //    Top edge of mask -->  ____________________
+        //                         /         / \        \
+        // Left edge of mask -->  /         /   \        \
+        //                       /         /     \        \
+        //                      /    #    /   @   \    &   \
+        //                     /         /         \        \  <-- Right edge of mask
+        //                    /         /           \        \
+        //                    ---------- ----------- ----------  <-- Bottom edge of mask
+        //        Left line threshold  ^             ^ Right line threshold
+        //
+        // Any lines within:
+        //      '#' region will be considered left lines
+        //      '@' region will be considered middle lines
+        //      '&' region will be considered right lines
+        //
+        // Within OpenCV, the origin is located at the top left of the frame. Thus, left lines should have negative
+        // gradients and right positive gradients.
+
+        // Remove the left edge of the ROI frame
+        if (IS_BELOW_LINE(Globals::G_LEFT_EDGE_OF_MASK_M, Globals::G_LEFT_EDGE_OF_MASK_C, EDGE_OF_MASK_BUFFER, true))
+        {
+            return Globals::HoughLineTypes::LEFT_EDGE;
+        }
+
+        // If within left threshold and has a negative gradient (meaning the line follows the expected path shown in the
+        // diagram above), then it is a left line
+        if (IS_BELOW_LINE(Globals::G_LEFT_LINE_THRESHOLD_M, Globals::G_LEFT_LINE_THRESHOLD_C, 0, false) && GRADIENT < 0)
+        {
+            return Globals::HoughLineTypes::LEFT;
+        }
+
+        // Remove the right edge of the ROI frame
+        if (IS_BELOW_LINE(Globals::G_RIGHT_EDGE_OF_MASK_M, Globals::G_RIGHT_EDGE_OF_MASK_C, EDGE_OF_MASK_BUFFER, true))
+        {
+            return Globals::HoughLineTypes::RIGHT_EDGE;
+        }
+
+        // If within right threshold and has a positive gradient, then it is a right line
+        if (IS_BELOW_LINE(Globals::G_RIGHT_LINE_THRESHOLD_M, Globals::G_RIGHT_LINE_THRESHOLD_C, 0, false) && GRADIENT > 0)
+        {
+            return Globals::HoughLineTypes::RIGHT;
+        }
+
+        // Otherwise the line is a middle line
+        return Globals::HoughLineTypes::MIDDLE;
+    }
+}
@@ -1,8 +1,10 @@
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <deque>
 #include <limits>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -14,7 +16,11 @@
 #include <opencv2/core/types.hpp>
 #include <opencv2/imgproc.hpp>
 
+#include "detectors/HoughLineClassifier.hpp"
+#include "detectors/ObjectOccupancyMask.hpp"
+#include "helpers/FrameGeometry.hpp"
 #include "helpers/Globals.hpp"
+#include "helpers/ImageKernels.hpp"
 #include "helpers/Information.hpp"
 
 #include "detectors/LaneDetector.hpp"
@@ -22,44 +28,84 @@
 namespace LaneAndObjectDetection
 {
     LaneDetector::LaneDetector() :
+        m_laneDetectionInformation(std::make_shared<LaneDetectionInformation>()),
         m_currentDrivingState(Globals::DrivingState::NO_LANE_MARKINGS_DETECTED),
+        m_scale(Globals::LaneDetectorScales::FULL),
         m_changingLanesPreviousDistanceDifference(0),
-        m_leftLineAverageLength(0),
-        m_middleLineAverageLength(0),
-        m_rightLineAverageLength(0),
         m_changingLanesFrameCount(0),
         m_changingLanesFirstFrame(false)
-    {}
+    {
+        m_laneDetectionInformation->m_drivingState = Globals::DrivingState::NO_LANE_MARKINGS_DETECTED;
+        m_laneDetectionInformation->m_leftLineType = Globals::LineTypes::EMPTY;
+        m_laneDetectionInformation->m_rightLineType = Globals::LineTypes::EMPTY;
+
+        SetScale(m_scale);
+    }
 
-    void LaneDetector::RunLaneDetector(const cv::Mat& p_frame, const ObjectDetectionInformation& p_objectDetectionInformation, const bool& p_debugMode)
+    void LaneDetector::RunLaneDetector(const cv::Mat& p_frame, const ObjectDetectionInformation& p_objectDetectionInformation)
     {
-        // Get region of interest (ROI) frame by applying a mask on to the frame
-        cv::Mat blankFrame = cv::Mat::zeros(Globals::G_VIDEO_INPUT_HEIGHT, Globals::G_VIDEO_INPUT_WIDTH, p_frame.type());
-        cv::fillConvexPoly(blankFrame, Globals::G_ROI_MASK_POINTS, Globals::G_COLOUR_WHITE);
-        cv::bitwise_and(blankFrame, p_frame, m_laneDetectionInformation.m_roiFrame);
-        cv::cvtColor(m_laneDetectionInformation.m_roiFrame, m_laneDetectionInformation.m_roiFrame, cv::COLOR_BGR2GRAY);
+        RunLaneDetectorFrontEnd(p_frame);
 
-        // Get edges using Canny Algorithm on the ROI Frame
-        cv::Canny(m_laneDetectionInformation.m_roiFrame, m_laneDetectionInformation.m_cannyFrame, Globals::G_CANNY_ALGORITHM_LOWER_THRESHOLD, Globals::G_CANNY_ALGORITHM_UPPER_THRESHOLD);
+        RunLaneDetectorBackEnd(p_objectDetectionInformation);
+    }
 
-        // Get straight lines using the Probabilistic Hough Transform (PHT) on te output of Canny Algorithm
-        std::vector<cv::Vec4i> houghLines;
-        m_laneDetectionInformation.m_houghLinesFrame = cv::Mat::zeros(Globals::G_VIDEO_INPUT_HEIGHT, Globals::G_VIDEO_INPUT_WIDTH, p_frame.type());
-        cv::HoughLinesP(m_laneDetectionInformation.m_cannyFrame, houghLines, Globals::G_HOUGH_RHO, Globals::G_HOUGH_THETA, Globals::G_HOUGH_THRESHOLD, Globals::G_HOUGH_MIN_LINE_LENGTH, Globals::G_HOUGH_MAX_LINE_GAP);
+    void LaneDetector::RunLaneDetectorFrontEnd(const cv::Mat& p_frame)
+    {
+        // Copy on write if a snapshot of the previous frame is still held. Only this thread can create new references so a use
+        // count of one means that there are no other holders. The driving state persists between frames so the previous
+        // information is kept, but the frame buffers are released as they would otherwise be overwritten in place.
+        if (m_laneDetectionInformation.use_count() > 1)
+        {
+            m_laneDetectionInformation = std::make_shared<LaneDetectionInformation>(*m_laneDetectionInformation);
+            m_laneDetectionInformation->m_roiFrame.release();
+            m_laneDetectionInformation->m_cannyFrame.release();
+        }
 
-        AnalyseHoughLines(houghLines, p_objectDetectionInformation, p_debugMode);
+        // Get region of interest (ROI) frame by masking and converting the ROI bounding box of the frame to grey in a single
+        // pass, as nothing outside of it is used
+        const cv::Mat ROI_BOUNDING_BOX = p_frame(m_frameGeometry.m_roiBoundingBox);
 
-        if (p_debugMode)
+        if (ROI_BOUNDING_BOX.size() == m_scaledRoiSize)
         {
-            m_laneDetectionInformation.m_roiFrame = m_laneDetectionInformation.m_roiFrame(Globals::G_ROI_BOUNDING_BOX_Y_RANGE, Globals::G_ROI_BOUNDING_BOX_X_RANGE);
-            m_laneDetectionInformation.m_cannyFrame = m_laneDetectionInformation.m_cannyFrame(Globals::G_ROI_BOUNDING_BOX_Y_RANGE, Globals::G_ROI_BOUNDING_BOX_X_RANGE);
-            m_laneDetectionInformation.m_houghLinesFrame = m_laneDetectionInformation.m_houghLinesFrame(Globals::G_ROI_BOUNDING_BOX_Y_RANGE, Globals::G_ROI_BOUNDING_BOX_X_RANGE);
+            ImageKernels::ConvertMaskedBgrToGrey(ROI_BOUNDING_BOX, m_roiRowSpans, m_laneDetectionInformation->m_roiFrame);
+        }
 
-            cv::resize(m_laneDetectionInformation.m_roiFrame, m_laneDetectionInformation.m_roiFrame, {}, Globals::G_DEBUGGING_FRAME_SCALING_FACTOR, Globals::G_DEBUGGING_FRAME_SCALING_FACTOR, cv::INTER_AREA);
-            cv::resize(m_laneDetectionInformation.m_cannyFrame, m_laneDetectionInformation.m_cannyFrame, {}, Globals::G_DEBUGGING_FRAME_SCALING_FACTOR, Globals::G_DEBUGGING_FRAME_SCALING_FACTOR, cv::INTER_AREA);
-            cv::resize(m_laneDetectionInformation.m_houghLinesFrame, m_laneDetectionInformation.m_houghLinesFrame, {}, Globals::G_DEBUGGING_FRAME_SCALING_FACTOR, Globals::G_DEBUGGING_FRAME_SCALING_FACTOR, cv::INTER_AREA);
+        else
+        {
+            cv::resize(ROI_BOUNDING_BOX, m_scaledRoiBoundingBox, m_scaledRoiSize, 0, 0, cv::INTER_AREA);
+            ImageKernels::ConvertMaskedBgrToGrey(m_scaledRoiBoundingBox, m_roiRowSpans, m_laneDetectionInformation->m_roiFrame);
         }
 
+        // Get edges using Canny Algorithm on the ROI Frame, split into horizontal stripes across all OpenCV threads
+        ImageKernels::RunStripedCanny(m_laneDetectionInformation->m_roiFrame,
+                                      m_laneDetectionInformation->m_cannyFrame,
+                                      Globals::G_CANNY_ALGORITHM_LOWER_THRESHOLD,
+                                      Globals::G_CANNY_ALGORITHM_UPPER_THRESHOLD,
+                                      cv::getNumThreads(),
+                                      m_cannyStripes);
+
+        // Get straight lines using the Probabilistic Hough Transform (PHT) on te output of Canny Algorithm. This runs once on
+        // the merged edges, rather than per stripe, as lane lines cross the stripe boundaries. The lengths and number of votes
+        // along a line shrink with the scale (relative to the reference resolution), so the parameters are scaled to match.
+        const double SCALE = (m_roiScalingFactors.x + m_roiScalingFactors.y) / 2.0;
+        const int32_t HOUGH_THRESHOLD = std::max(static_cast<int32_t>(std::lround(Globals::G_HOUGH_THRESHOLD / SCALE)), 1);
+        cv::HoughLinesP(m_laneDetectionInformation->m_cannyFrame, m_houghLines, Globals::G_HOUGH_RHO, Globals::G_HOUGH_THETA, HOUGH_THRESHOLD, Globals::G_HOUGH_MIN_LINE_LENGTH / SCALE, Globals::G_HOUGH_MAX_LINE_GAP / SCALE);
+
+        // Map the hough lines from scaled ROI bounding box co-ordinates to reference co-ordinates, which all of the lane
+        // classification thresholds are defined in
+        for (cv::Vec4i& houghLine : m_houghLines)
+        {
+            houghLine[Globals::G_VEC4_X1_INDEX] = m_referenceRoiBoundingBox.x + static_cast<int32_t>(std::lround(houghLine[Globals::G_VEC4_X1_INDEX] * m_roiScalingFactors.x));
+            houghLine[Globals::G_VEC4_Y1_INDEX] = m_referenceRoiBoundingBox.y + static_cast<int32_t>(std::lround(houghLine[Globals::G_VEC4_Y1_INDEX] * m_roiScalingFactors.y));
+            houghLine[Globals::G_VEC4_X2_INDEX] = m_referenceRoiBoundingBox.x + static_cast<int32_t>(std::lround(houghLine[Globals::G_VEC4_X2_INDEX] * m_roiScalingFactors.x));
+            houghLine[Globals::G_VEC4_Y2_INDEX] = m_referenceRoiBoundingBox.y + static_cast<int32_t>(std::lround(houghLine[Globals::G_VEC4_Y2_INDEX] * m_roiScalingFactors.y));
+        }
+    }
+
+    void LaneDetector::RunLaneDetectorBackEnd(const ObjectDetectionInformation& p_objectDetectionInformation)
+    {
+        AnalyseHoughLines(p_objectDetectionInformation);
+
         UpdateLineTypes();
 
         UpdateDrivingState();
@@ -67,11 +113,48 @@ namespace LaneAndObjectDetection
         ExecuteDrivingState();
     }
 
-    LaneDetectionInformation LaneDetector::GetInformation()
+    const LaneDetectionInformation& LaneDetector::GetInformation()
+    {
+        return *m_laneDetectionInformation;
+    }
+
+    std::shared_ptr<const LaneDetectionInformation> LaneDetector::GetInformationSnapshot()
     {
         return m_laneDetectionInformation;
     }
 
+    void LaneDetector::SetScale(const Globals::LaneDetectorScales& p_scale)
+    {
+        m_scale = p_scale;
+
+        const cv::Size ROI_BOUNDING_BOX_SIZE = m_frameGeometry.m_roiBoundingBox.size();
+        const int32_t SCALE = static_cast<int32_t>(m_scale);
+        m_scaledRoiSize = cv::Size(std::max(ROI_BOUNDING_BOX_SIZE.width / SCALE, 1), std::max(ROI_BOUNDING_BOX_SIZE.height / SCALE, 1));
+        m_referenceRoiBoundingBox = cv::Rect(m_frameGeometry.ToReference(m_frameGeometry.m_roiBoundingBox.tl()), m_frameGeometry.ToReference(m_frameGeometry.m_roiBoundingBox.br()));
+        m_roiScalingFactors = cv::Point2d(static_cast<double>(m_referenceRoiBoundingBox.width) / m_scaledRoiSize.width,
+                                          static_cast<double>(m_referenceRoiBoundingBox.height) / m_scaledRoiSize.height);
+
+        // Calculate the ROI mask row spans in scaled ROI bounding box co-ordinates
+        std::array<cv::Point, Globals::G_NUMBER_OF_POINTS> scaledRoiMaskPoints {};
+        for (uint32_t i = 0; i < Globals::G_NUMBER_OF_POINTS; i++)
+        {
+            const cv::Point ROI_MASK_POINT = Globals::G_ROI_MASK_POINTS[i] - m_referenceRoiBoundingBox.tl();
+            scaledRoiMaskPoints[i] = cv::Point(std::lround(ROI_MASK_POINT.x / m_roiScalingFactors.x), std::lround(ROI_MASK_POINT.y / m_roiScalingFactors.y));
+        }
+
+        ImageKernels::ComputeTrapezoidRowSpans(scaledRoiMaskPoints, cv::Rect(cv::Point(0, 0), m_scaledRoiSize), m_roiRowSpans);
+
+        // The hough lines are mapped back to reference co-ordinates within the ROI bounding box
+        m_objectOccupancyMask.SetRegion(m_referenceRoiBoundingBox);
+    }
+
+    void LaneDetector::SetFrameGeometry(const FrameGeometry& p_frameGeometry)
+    {
+        m_frameGeometry = p_frameGeometry;
+
+        SetScale(m_scale);
+    }
+
     template<typename T>
     LaneDetector::RollingAverage<T>::RollingAverage()
     {
@@ -105,202 +188,48 @@ namespace LaneAndObjectDetection
         return mostFrequentElement;
     }
 
-    void LaneDetector::AnalyseHoughLines(const std::vector<cv::Vec4i>& p_houghLines, const ObjectDetectionInformation& p_objectDetectionInformation, const bool& p_debugMode) // NOLINT(readability-function-cognitive-complexity)
+    void LaneDetector::AnalyseHoughLines(const ObjectDetectionInformation& p_objectDetectionInformation)
     {
-        m_leftLaneLines.clear();
-        m_middleLaneLines.clear();
-        m_rightLaneLines.clear();
-        m_leftLineAverageLength = 0;
-        m_middleLineAverageLength = 0;
-        m_rightLineAverageLength = 0;
-
-        for (const cv::Vec4i& houghLine : p_houghLines)
-        {
-            const cv::Point POINT_ONE = cv::Point(houghLine[Globals::G_VEC4_X1_INDEX], houghLine[Globals::G_VEC4_Y1_INDEX]);
-            const cv::Point POINT_TWO = cv::Point(houghLine[Globals::G_VEC4_X2_INDEX], houghLine[Globals::G_VEC4_Y2_INDEX]);
-
-            const double CHANGE_IN_X = houghLine[Globals::G_VEC4_X1_INDEX] - houghLine[Globals::G_VEC4_X2_INDEX];
-            const double CHANGE_IN_Y = houghLine[Globals::G_VEC4_Y1_INDEX] - houghLine[Globals::G_VEC4_Y2_INDEX];
-
-            // Filter out vertical lines
-            if (CHANGE_IN_X == 0)
-            {
-                if (p_debugMode)
-                {
-                    cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_WHITE, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-                }
-                continue;
-            }
+        m_objectOccupancyMask.Update(p_objectDetectionInformation, m_frameGeometry);
 
-            const double GRADIENT = CHANGE_IN_Y / CHANGE_IN_X;
+        m_houghLineClassifier.Run(m_houghLines, m_objectOccupancyMask);
 
-            // Filter out horizontal lines
-            if (std::fabs(GRADIENT) < Globals::G_HOUGH_LINE_HORIZONTAL_GRADIENT_THRESHOLD)
-            {
-                if (p_debugMode)
-                {
-                    cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_GREY, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-                }
-                continue;
-            }
-
-            // The bounding boxes are created by the object detector which cannot detect road markings. Thus, if the line is in
-            // a bounding box, it cannot be a road marking and is ignored.
-            if (IsLineWithinObjectBoundingBoxes(houghLine, p_objectDetectionInformation))
-            {
-                if (p_debugMode)
-                {
-                    cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_YELLOW, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-                }
-                continue;
-            }
-
-            // ROI frame:
-            //
-            //    Top edge of mask -->  ____________________
-            //                         /         / \        \
-            // Left edge of mask -->  /         /   \        \
-            //                       /         /     \        \
-            //                      /    #    /   @   \    &   \
-            //                     /         /         \        \  <-- Right edge of mask
-            //                    /         /           \        \
-            //                    ---------- ----------- ----------  <-- Bottom edge of mask
-            //        Left line threshold  ^             ^ Right line threshold
-            //
-            // Any lines within:
-            //      '#' region will be considered left lines
-            //      '@' region will be considered middle lines
-            //      '&' region will be considered right lines
-            //
-            // Within OpenCV, the origin is located at the top left of the frame. Thus, left lines should have negative
-            // gradients and right positive gradients.
-
-            // Remove the left edge of the ROI frame
-            const double LEFT_EDGE_Y1 = (Globals::G_LEFT_EDGE_OF_MASK_M * houghLine[Globals::G_VEC4_X1_INDEX]) + Globals::G_LEFT_EDGE_OF_MASK_C;
-            const double LEFT_EDGE_Y2 = (Globals::G_LEFT_EDGE_OF_MASK_M * houghLine[Globals::G_VEC4_X2_INDEX]) + Globals::G_LEFT_EDGE_OF_MASK_C;
-            if ((houghLine[Globals::G_VEC4_Y1_INDEX] <= LEFT_EDGE_Y1 + 1) && (houghLine[Globals::G_VEC4_Y2_INDEX] <= LEFT_EDGE_Y2 + 1)) // +1 for extra buffer
-            {
-                if (p_debugMode)
-                {
-                    cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_LIGHT_RED, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-                }
-                continue;
-            }
-
-            // If within left threshold and has a negative gradient (meaning the line follows the expected path shown in the
-            // diagram above), then it is a left line
-            const double LEFT_THRESHOLD_Y1 = (Globals::G_LEFT_LINE_THRESHOLD_M * houghLine[Globals::G_VEC4_X1_INDEX]) + Globals::G_LEFT_LINE_THRESHOLD_C;
-            const double LEFT_THRESHOLD_Y2 = (Globals::G_LEFT_LINE_THRESHOLD_M * houghLine[Globals::G_VEC4_X2_INDEX]) + Globals::G_LEFT_LINE_THRESHOLD_C;
-            if ((houghLine[Globals::G_VEC4_Y1_INDEX] < LEFT_THRESHOLD_Y1) && (houghLine[Globals::G_VEC4_Y2_INDEX] < LEFT_THRESHOLD_Y2) && GRADIENT < 0)
-            {
-                m_leftLaneLines.push_back(houghLine);
-                m_leftLineAverageLength += std::sqrt(
-                    ((houghLine[Globals::G_VEC4_X1_INDEX] - houghLine[Globals::G_VEC4_X2_INDEX]) * (houghLine[Globals::G_VEC4_X1_INDEX] - houghLine[Globals::G_VEC4_X2_INDEX])) +
-                    ((houghLine[Globals::G_VEC4_Y1_INDEX] - houghLine[Globals::G_VEC4_Y2_INDEX]) * (houghLine[Globals::G_VEC4_Y1_INDEX] - houghLine[Globals::G_VEC4_Y2_INDEX])));
-
-                if (p_debugMode)
-                {
-                    cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_RED, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-                }
-                continue;
-            }
-
-            // Remove the right edge of the ROI frame
-            const double RIGHT_EDGE_Y1 = (Globals::G_RIGHT_EDGE_OF_MASK_M * houghLine[Globals::G_VEC4_X1_INDEX]) + Globals::G_RIGHT_EDGE_OF_MASK_C;
-            const double RIGHT_EDGE_Y2 = (Globals::G_RIGHT_EDGE_OF_MASK_M * houghLine[Globals::G_VEC4_X2_INDEX]) + Globals::G_RIGHT_EDGE_OF_MASK_C;
-            if ((houghLine[Globals::G_VEC4_Y1_INDEX] <= RIGHT_EDGE_Y1 + 1) && (houghLine[Globals::G_VEC4_Y2_INDEX] <= RIGHT_EDGE_Y2 + 1)) // +1 for extra buffer
-            {
-                if (p_debugMode)
-                {
-                    cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_LIGHT_BLUE, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-                }
-                continue;
-            }
-
-            // If within right threshold and has a positive gradient (meaning the line follows the expected path shown in the
-            // diagram above), then it is a right line
-            const double RIGHT_THRESHOLD_Y1 = (Globals::G_RIGHT_LINE_THRESHOLD_M * houghLine[Globals::G_VEC4_X1_INDEX]) + Globals::G_RIGHT_LINE_THRESHOLD_C;
-            const double RIGHT_THRESHOLD_Y2 = (Globals::G_RIGHT_LINE_THRESHOLD_M * houghLine[Globals::G_VEC4_X2_INDEX]) + Globals::G_RIGHT_LINE_THRESHOLD_C;
-            if ((houghLine[Globals::G_VEC4_Y1_INDEX] < RIGHT_THRESHOLD_Y1) && (houghLine[Globals::G_VEC4_Y2_INDEX] < RIGHT_THRESHOLD_Y2) && GRADIENT > 0)
-            {
-                m_rightLaneLines.push_back(houghLine);
-                m_rightLineAverageLength += std::sqrt(
-                    ((houghLine[Globals::G_VEC4_X1_INDEX] - houghLine[Globals::G_VEC4_X2_INDEX]) * (houghLine[Globals::G_VEC4_X1_INDEX] - houghLine[Globals::G_VEC4_X2_INDEX])) +
-                    ((houghLine[Globals::G_VEC4_Y1_INDEX] - houghLine[Globals::G_VEC4_Y2_INDEX]) * (houghLine[Globals::G_VEC4_Y1_INDEX] - houghLine[Globals::G_VEC4_Y2_INDEX])));
-
-                if (p_debugMode)
-                {
-                    cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_BLUE, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-                }
-
-                continue;
-            }
-
-            // Otherwise the line is be a middle line
-            m_middleLaneLines.push_back(houghLine);
-            m_middleLineAverageLength += std::sqrt(
-                ((houghLine[Globals::G_VEC4_X1_INDEX] - houghLine[Globals::G_VEC4_X2_INDEX]) * (houghLine[Globals::G_VEC4_X1_INDEX] - houghLine[Globals::G_VEC4_X2_INDEX])) +
-                ((houghLine[Globals::G_VEC4_Y1_INDEX] - houghLine[Globals::G_VEC4_Y2_INDEX]) * (houghLine[Globals::G_VEC4_Y1_INDEX] - houghLine[Globals::G_VEC4_Y2_INDEX])));
-
-            if (p_debugMode)
-            {
-                cv::line(m_laneDetectionInformation.m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_COLOUR_GREEN, Globals::G_HOUGH_LINE_THICKNESS, cv::LINE_AA);
-            }
-        }
-
-        m_leftLineAverageLength /= static_cast<double>(m_leftLaneLines.size());
-        m_middleLineAverageLength /= static_cast<double>(m_middleLaneLines.size());
-        m_rightLineAverageLength /= static_cast<double>(m_rightLaneLines.size());
-    }
-
-    bool LaneDetector::IsLineWithinObjectBoundingBoxes(const cv::Vec4i& p_houghLine, const ObjectDetectionInformation& p_objectDetectionInformation)
-    {
-        for (const ObjectDetectionInformation::DetectedObjectInformation& detectedObjectInformation : p_objectDetectionInformation.m_objectInformation)
-        {
-            const int32_t LOWER_X = detectedObjectInformation.m_boundingBox.x;
-            const int32_t UPPER_X = detectedObjectInformation.m_boundingBox.x + detectedObjectInformation.m_boundingBox.width;
-            const int32_t LOWER_Y = detectedObjectInformation.m_boundingBox.y;
-            const int32_t UPPER_Y = detectedObjectInformation.m_boundingBox.y + detectedObjectInformation.m_boundingBox.height;
-
-            // The OR operator means that only whole line does not need to be within the bounding box for the line to be
-            // considered within the bounding boxes
-            if ((p_houghLine[Globals::G_VEC4_X1_INDEX] >= LOWER_X && p_houghLine[Globals::G_VEC4_X1_INDEX] <= UPPER_X &&
-                 p_houghLine[Globals::G_VEC4_Y1_INDEX] >= LOWER_Y && p_houghLine[Globals::G_VEC4_Y1_INDEX] <= UPPER_Y) ||
-                (p_houghLine[Globals::G_VEC4_X2_INDEX] >= LOWER_X && p_houghLine[Globals::G_VEC4_X2_INDEX] <= UPPER_X &&
-                 p_houghLine[Globals::G_VEC4_Y2_INDEX] >= LOWER_Y && p_houghLine[Globals::G_VEC4_Y2_INDEX] <= UPPER_Y))
-            {
-                return true;
-            }
-        }
-
-        return false;
+        // Only the lines and their types are recorded, the debug frames are drawn from them when they are displayed
+        m_laneDetectionInformation->m_houghLines = m_houghLines;
+        m_laneDetectionInformation->m_houghLineTypes = m_houghLineClassifier.GetLineTypes();
     }
 
     void LaneDetector::UpdateLineTypes()
     {
-        m_laneDetectionInformation.m_drivingStateSubTitle = "(L = Solid )";
-        if (m_leftLaneLines.empty())
+        m_laneDetectionInformation->m_drivingStateSubTitle = "(L = Solid )";
+        m_laneDetectionInformation->m_leftLineType = Globals::LineTypes::SOLID;
+        if (m_houghLineClassifier.GetLeftLineIndices().empty())
         {
-            m_laneDetectionInformation.m_drivingStateSubTitle = "(L = Empty )";
+            m_laneDetectionInformation->m_drivingStateSubTitle = "(L = Empty )";
+            m_laneDetectionInformation->m_leftLineType = Globals::LineTypes::EMPTY;
         }
 
-        else if (m_leftLineAverageLength < Globals::G_SOLID_LINE_LENGTH_THRESHOLD)
+        else if (m_houghLineClassifier.GetLeftLineAverageLength() < Globals::G_SOLID_LINE_LENGTH_THRESHOLD)
         {
-            m_laneDetectionInformation.m_drivingStateSubTitle = "(L = Dashed)";
+            m_laneDetectionInformation->m_drivingStateSubTitle = "(L = Dashed)";
+            m_laneDetectionInformation->m_leftLineType = Globals::LineTypes::DASHED;
         }
 
         std::string rightLaneLineState = "   (R = Solid )";
-        if (m_rightLaneLines.empty())
+        m_laneDetectionInformation->m_rightLineType = Globals::LineTypes::SOLID;
+        if (m_houghLineClassifier.GetRightLineIndices().empty())
         {
             rightLaneLineState = "   (R = Empty )";
+            m_laneDetectionInformation->m_rightLineType = Globals::LineTypes::EMPTY;
         }
 
-        else if (m_rightLineAverageLength < Globals::G_SOLID_LINE_LENGTH_THRESHOLD)
+        else if (m_houghLineClassifier.GetRightLineAverageLength() < Globals::G_SOLID_LINE_LENGTH_THRESHOLD)
         {
             rightLaneLineState = "   (R = Dashed)";
+            m_laneDetectionInformation->m_rightLineType = Globals::LineTypes::DASHED;
         }
 
-        m_laneDetectionInformation.m_drivingStateSubTitle += rightLaneLineState;
+        m_laneDetectionInformation->m_drivingStateSubTitle += rightLaneLineState;
     }
 
     void LaneDetector::UpdateDrivingState()
@@ -318,9 +247,9 @@ namespace LaneAndObjectDetection
         // |                 |                   |     Detected     | ONLY_RIGHT_LANE_MARKING_DETECTED |
         // |                 |                   |                  |     NO_LANE_MARKINGS_DETECTED    |
 
-        const bool LEFT_LINES_PRESENT = !m_leftLaneLines.empty();
-        const bool MIDDLE_LINES_PRESENT = !m_middleLaneLines.empty();
-        const bool RIGHT_LINES_PRESNET = !m_rightLaneLines.empty();
+        const bool LEFT_LINES_PRESENT = !m_houghLineClassifier.GetLeftLineIndices().empty();
+        const bool MIDDLE_LINES_PRESENT = !m_houghLineClassifier.GetMiddleLineIndices().empty();
+        const bool RIGHT_LINES_PRESNET = !m_houghLineClassifier.GetRightLineIndices().empty();
 
         Globals::DrivingState currentDrivingState = Globals::DrivingState::NO_LANE_MARKINGS_DETECTED;
 
@@ -358,7 +287,7 @@ namespace LaneAndObjectDetection
                 m_changingLanesFrameCount = 0;
                 m_changingLanesPreviousDistanceDifference = 0;
                 m_changingLanesFirstFrame = true;
-                m_laneDetectionInformation.m_drivingStateSubTitle = "";
+                m_laneDetectionInformation->m_drivingStateSubTitle = "";
             }
         }
 
@@ -368,9 +297,10 @@ namespace LaneAndObjectDetection
     void LaneDetector::ExecuteDrivingState()
     {
         // Set titles based on driving state
-        m_laneDetectionInformation.m_drivingStateTitle = Globals::G_DRIVING_STATE_TITLES.find(m_currentDrivingState)->second;
+        m_laneDetectionInformation->m_drivingStateTitle = Globals::G_DRIVING_STATE_TITLES.find(m_currentDrivingState)->second;
+        m_laneDetectionInformation->m_drivingState = m_currentDrivingState;
 
-        m_laneDetectionInformation.m_laneOverlayCorners = {
+        m_laneDetectionInformation->m_laneOverlayCorners = {
             {0, 0},
             {0, 0},
             {0, 0},
@@ -395,12 +325,21 @@ namespace LaneAndObjectDetection
         default:
             throw Globals::Exceptions::NotImplementedError();
         }
+
+        // The lane overlay is calculated in reference co-ordinates but drawn on the frame
+        for (cv::Point& laneOverlayCorner : m_laneDetectionInformation->m_laneOverlayCorners)
+        {
+            laneOverlayCorner = m_frameGeometry.FromReference(laneOverlayCorner);
+        }
     }
 
     void LaneDetector::CalculateLanePosition()
     {
+        const std::vector<uint32_t>& LEFT_LINE_INDICES = m_houghLineClassifier.GetLeftLineIndices();
+        const std::vector<uint32_t>& RIGHT_LINE_INDICES = m_houghLineClassifier.GetRightLineIndices();
+
         // Skip if either no left or right lane lines detected
-        if (m_leftLaneLines.empty() || m_rightLaneLines.empty())
+        if (LEFT_LINE_INDICES.empty() || RIGHT_LINE_INDICES.empty())
         {
             return;
         }
@@ -409,8 +348,10 @@ namespace LaneAndObjectDetection
         double leftLaneLineM = 0;
         double leftLaneLineMinimumY = std::numeric_limits<double>::max();
 
-        for (const cv::Vec4i& leftLaneLine : m_leftLaneLines)
+        for (const uint32_t& leftLineIndex : LEFT_LINE_INDICES)
         {
+            const cv::Vec4i& leftLaneLine = m_houghLines[leftLineIndex];
+
             // Find the minimum height of a left lane line
             leftLaneLineMinimumY = std::min({static_cast<double>(leftLaneLine[Globals::G_VEC4_Y1_INDEX]),
                                              static_cast<double>(leftLaneLine[Globals::G_VEC4_Y2_INDEX]),
@@ -422,19 +363,21 @@ namespace LaneAndObjectDetection
             leftLaneLineC += leftLaneLine[Globals::G_VEC4_Y1_INDEX] - ((leftLaneLine[Globals::G_VEC4_Y1_INDEX] - leftLaneLine[Globals::G_VEC4_Y2_INDEX]) / static_cast<double>(leftLaneLine[Globals::G_VEC4_X1_INDEX] - leftLaneLine[Globals::G_VEC4_X2_INDEX]) * leftLaneLine[Globals::G_VEC4_X1_INDEX]);
         }
 
-        if (!m_leftLaneLines.empty())
+        if (!LEFT_LINE_INDICES.empty())
         {
-            leftLaneLineM /= static_cast<double>(m_leftLaneLines.size());
-            leftLaneLineC /= static_cast<double>(m_leftLaneLines.size());
+            leftLaneLineM /= static_cast<double>(LEFT_LINE_INDICES.size());
+            leftLaneLineC /= static_cast<double>(LEFT_LINE_INDICES.size());
         }
 
-        // The same logic as above but for m_rightLaneLines
+        // The same logic as above but for the right lane lines
         double rightLaneLineC = 0;
         double rightLaneLineM = 0;
         double rightLaneLineMinimumY = std::numeric_limits<double>::max();
 
-        for (const cv::Vec4i& rightLaneLine : m_rightLaneLines)
+        for (const uint32_t& rightLineIndex : RIGHT_LINE_INDICES)
         {
+            const cv::Vec4i& rightLaneLine = m_houghLines[rightLineIndex];
+
             // Find the minimum height of a right lane line
             rightLaneLineMinimumY = std::min({static_cast<double>(rightLaneLine[Globals::G_VEC4_Y1_INDEX]),
                                               static_cast<double>(rightLaneLine[Globals::G_VEC4_Y2_INDEX]),
@@ -446,10 +389,10 @@ namespace LaneAndObjectDetection
             rightLaneLineC += rightLaneLine[Globals::G_VEC4_Y1_INDEX] - ((rightLaneLine[Globals::G_VEC4_Y1_INDEX] - rightLaneLine[Globals::G_VEC4_Y2_INDEX]) / static_cast<double>(rightLaneLine[Globals::G_VEC4_X1_INDEX] - rightLaneLine[Globals::G_VEC4_X2_INDEX]) * rightLaneLine[Globals::G_VEC4_X1_INDEX]);
         }
 
-        if (!m_rightLaneLines.empty())
+        if (!RIGHT_LINE_INDICES.empty())
         {
-            rightLaneLineM /= static_cast<double>(m_rightLaneLines.size());
-            rightLaneLineC /= static_cast<double>(m_rightLaneLines.size());
+            rightLaneLineM /= static_cast<double>(RIGHT_LINE_INDICES.size());
+            rightLaneLineC /= static_cast<double>(RIGHT_LINE_INDICES.size());
         }
 
         // Find the minimum lane line height - due to OpenCV origin being located at the top left of the frame, visually this
@@ -482,16 +425,18 @@ namespace LaneAndObjectDetection
         // would intersect within the visible section and the overlay would turn in to an hourglass as shown above.
         if (INTERSECTION_Y0 < LANE_LINE_MINIMUM_Y)
         {
-            m_laneDetectionInformation.m_laneOverlayCorners[0] = cv::Point(static_cast<int32_t>((LANE_LINE_MINIMUM_Y - leftLaneLineC) / leftLaneLineM), static_cast<int32_t>(LANE_LINE_MINIMUM_Y));   // Top left
-            m_laneDetectionInformation.m_laneOverlayCorners[1] = cv::Point(static_cast<int32_t>((LANE_LINE_MINIMUM_Y - rightLaneLineC) / rightLaneLineM), static_cast<int32_t>(LANE_LINE_MINIMUM_Y)); // Top right
-            m_laneDetectionInformation.m_laneOverlayCorners[2] = cv::Point(static_cast<int32_t>((Globals::G_ROI_BOTTOM_HEIGHT - rightLaneLineC) / rightLaneLineM), Globals::G_ROI_BOTTOM_HEIGHT);     // Bottom right
-            m_laneDetectionInformation.m_laneOverlayCorners[3] = cv::Point(static_cast<int32_t>((Globals::G_ROI_BOTTOM_HEIGHT - leftLaneLineC) / leftLaneLineM), Globals::G_ROI_BOTTOM_HEIGHT);       // Bottom left
+            m_laneDetectionInformation->m_laneOverlayCorners[0] = cv::Point(static_cast<int32_t>((LANE_LINE_MINIMUM_Y - leftLaneLineC) / leftLaneLineM), static_cast<int32_t>(LANE_LINE_MINIMUM_Y));   // Top left
+            m_laneDetectionInformation->m_laneOverlayCorners[1] = cv::Point(static_cast<int32_t>((LANE_LINE_MINIMUM_Y - rightLaneLineC) / rightLaneLineM), static_cast<int32_t>(LANE_LINE_MINIMUM_Y)); // Top right
+            m_laneDetectionInformation->m_laneOverlayCorners[2] = cv::Point(static_cast<int32_t>((Globals::G_ROI_BOTTOM_HEIGHT - rightLaneLineC) / rightLaneLineM), Globals::G_ROI_BOTTOM_HEIGHT);     // Bottom right
+            m_laneDetectionInformation->m_laneOverlayCorners[3] = cv::Point(static_cast<int32_t>((Globals::G_ROI_BOTTOM_HEIGHT - leftLaneLineC) / leftLaneLineM), Globals::G_ROI_BOTTOM_HEIGHT);       // Bottom left
         }
     }
 
     void LaneDetector::CalculateChangingLanesTurningDirection()
     {
-        if (m_middleLaneLines.empty())
+        const std::vector<uint32_t>& MIDDLE_LINE_INDICES = m_houghLineClassifier.GetMiddleLineIndices();
+
+        if (MIDDLE_LINE_INDICES.empty())
         {
             return;
         }
@@ -499,8 +444,10 @@ namespace LaneAndObjectDetection
         double averageDistanceFromLeft = 0;
         double averageDistanceFromRight = 0;
 
-        for (const cv::Vec4i& middleLaneLine : m_middleLaneLines)
+        for (const uint32_t& middleLineIndex : MIDDLE_LINE_INDICES)
         {
+            const cv::Vec4i& middleLaneLine = m_houghLines[middleLineIndex];
+
             // Determine X along the left/right edge of the mask using the Y co-ordinates of middleLaneLine and then use this X
             // value to compare with the actual X co-ordinates of middleLaneLine to determine the distance.
 
@@ -517,8 +464,8 @@ namespace LaneAndObjectDetection
             averageDistanceFromRight += std::fabs(middleLaneLine[Globals::G_VEC4_X2_INDEX] - RIGHT_EDGE_X2);
         }
 
-        averageDistanceFromLeft /= static_cast<double>(m_middleLaneLines.size() * 2);
-        averageDistanceFromRight /= static_cast<double>(m_middleLaneLines.size() * 2);
+        averageDistanceFromLeft /= static_cast<double>(MIDDLE_LINE_INDICES.size() * 2);
+        averageDistanceFromRight /= static_cast<double>(MIDDLE_LINE_INDICES.size() * 2);
 
         const double CURRENT_DISTANCE_DIFFERENCE = averageDistanceFromLeft - averageDistanceFromRight;
 
@@ -537,17 +484,17 @@ namespace LaneAndObjectDetection
 
             if (CHANGE_IN_DISTANCE_DIFFERENCE < 0)
             {
-                m_laneDetectionInformation.m_drivingStateSubTitle = "(Currently Turning Left)";
+                m_laneDetectionInformation->m_drivingStateSubTitle = "(Currently Turning Left)";
             }
 
             else if (CHANGE_IN_DISTANCE_DIFFERENCE > 0)
             {
-                m_laneDetectionInformation.m_drivingStateSubTitle = "(Currently Turning Right)";
+                m_laneDetectionInformation->m_drivingStateSubTitle = "(Currently Turning Right)";
             }
 
             else
             {
-                m_laneDetectionInformation.m_drivingStateSubTitle = "(Currently Not Turning)";
+                m_laneDetectionInformation->m_drivingStateSubTitle = "(Currently Not Turning)";
             }
 
             m_changingLanesPreviousDistanceDifference = CURRENT_DISTANCE_DIFFERENCE;
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "helpers/Globals.hpp"
+#include "helpers/ImageKernels.hpp"
+
+#include "detectors/LetterboxPreprocessor.hpp"
+
+namespace LaneAndObjectDetection
+{
+    LetterboxPreprocessor::LetterboxPreprocessor() :
+        m_scale(1),
+        m_blobSize(0)
+    {}
+
+    void LetterboxPreprocessor::Run(const cv::Mat& p_frame, const int32_t& p_blobSize)
+    {
+        Prepare(1, p_blobSize, p_frame.size());
+
+        LetterboxFrame(p_frame, 0);
+    }
+
+    void LetterboxPreprocessor::Run(const std::vector<cv::Mat>& p_frames, const int32_t& p_blobSize)
+    {
+        if (p_frames.empty())
+        {
+            return;
+        }
+
+        Prepare(static_cast<int32_t>(p_frames.size()), p_blobSize, p_frames.front().size());
+
+        for (int32_t batchIndex = 0; batchIndex < static_cast<int32_t>(p_frames.size()); batchIndex++)
+        {
+            LetterboxFrame(p_frames[batchIndex], batchIndex);
+        }
+    }
+
+    const cv::Mat& LetterboxPreprocessor::GetBlob()
+    {
+        return m_blob;
+    }
+
+    cv::Rect LetterboxPreprocessor::GetLetterbox()
+    {
+        return m_letterbox;
+    }
+
+    cv::Rect2d LetterboxPreprocessor::ToFrameBoundingBox(const float& p_centerX, const float& p_centerY, const float& p_width, const float& p_height)
+    {
+        const double WIDTH = p_width * m_blobSize / m_scale;
+        const double HEIGHT = p_height * m_blobSize / m_scale;
+        const double CENTER_X = ((p_centerX * m_blobSize) - m_letterbox.x) / m_scale;
+        const double CENTER_Y = ((p_centerY * m_blobSize) - m_letterbox.y) / m_scale;
+
+        return {CENTER_X - (WIDTH / Globals::G_DIVIDE_BY_TWO), CENTER_Y - (HEIGHT / Globals::G_DIVIDE_BY_TWO), WIDTH, HEIGHT};
+    }
+
+    void LetterboxPreprocessor::Prepare(const int32_t& p_batchSize, const int32_t& p_blobSize, const cv::Size& p_frameSize)
+    {
+        const std::array<int32_t, 4> BLOB_SHAPE = {p_batchSize, 3, p_blobSize, p_blobSize};
+        const uint8_t* PREVIOUS_DATA = m_blob.data;
+        m_blob.create(static_cast<int32_t>(BLOB_SHAPE.size()), BLOB_SHAPE.data(), CV_32F);
+
+        // Fit the frame within the blob while keeping its aspect ratio, and centre it
+        m_blobSize = p_blobSize;
+        m_scale = std::min(static_cast<double>(p_blobSize) / p_frameSize.width, static_cast<double>(p_blobSize) / p_frameSize.height);
+
+        const int32_t LETTERBOX_WIDTH = std::min(static_cast<int32_t>(std::lround(p_frameSize.width * m_scale)), p_blobSize);
+        const int32_t LETTERBOX_HEIGHT = std::min(static_cast<int32_t>(std::lround(p_frameSize.height * m_scale)), p_blobSize);
+        const cv::Rect LETTERBOX = cv::Rect((p_blobSize - LETTERBOX_WIDTH) / 2, (p_blobSize - LETTERBOX_HEIGHT) / 2, LETTERBOX_WIDTH, LETTERBOX_HEIGHT);
+
+        // The letterbox is overwritten by every frame, so the padding only needs to be written when the blob or letterbox
+        // changes
+        if (m_blob.data != PREVIOUS_DATA || LETTERBOX != m_letterbox)
+        {
+            m_blob.setTo(cv::Scalar::all(Globals::G_OBJECT_DETECTOR_LETTERBOX_PADDING));
+            m_letterbox = LETTERBOX;
+        }
+    }
+
+    void LetterboxPreprocessor::LetterboxFrame(const cv::Mat& p_frame, const int32_t& p_batchIndex)
+    {
+        const cv::Mat* resizedFrame = &p_frame;
+
+        if (p_frame.size() != m_letterbox.size())
+        {
+            cv::resize(p_frame, m_resizedFrame, m_letterbox.size(), 0, 0, cv::INTER_LINEAR);
+            resizedFrame = &m_resizedFrame;
+        }
+
+        // The Darknet weights expect RGB, so the red plane comes first
+        float* redPlane = m_blob.ptr<float>(p_batchIndex, 0);
+        float* greenPlane = m_blob.ptr<float>(p_batchIndex, 1);
+        float* bluePlane = m_blob.ptr<float>(p_batchIndex, 2);
+
+        for (int32_t row = 0; row < m_letterbox.height; row++)
+        {
+            const std::ptrdiff_t OFFSET = (static_cast<std::ptrdiff_t>(m_letterbox.y + row) * m_blobSize) + m_letterbox.x;
+
+            ImageKernels::ConvertBgrToScaledRgbPlanes(resizedFrame->ptr<uint8_t>(row),
+                                                      redPlane + OFFSET,
+                                                      greenPlane + OFFSET,
+                                                      bluePlane + OFFSET,
+                                                      m_letterbox.width,
+                                                      static_cast<float>(Globals::G_OBJECT_DETECTOR_SCALE_FACTOR));
+        }
+    }
+}
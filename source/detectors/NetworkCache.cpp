@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/dnn/dnn.hpp>
+#include <opencv2/imgcodecs.hpp>
+
+#include "detectors/LetterboxPreprocessor.hpp"
+#include "helpers/Globals.hpp"
+#include "helpers/MemoryMappedFile.hpp"
+#include "helpers/ModelBundle.hpp"
+
+#include "detectors/NetworkCache.hpp"
+
+namespace LaneAndObjectDetection
+{
+    NetworkCache::NetworkCache() :
+        m_useCount(0)
+    {
+        m_cachedNetworks.reserve(Globals::G_NETWORK_CACHE_CAPACITY);
+    }
+
+    NetworkCache::Network NetworkCache::GetNetwork(const std::string& p_yoloFolderPath,
+                                                   const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
+                                                   const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
+                                                   const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+    {
+        {
+            const std::lock_guard<std::mutex> LOCK(m_mutex);
+
+            const CachedNetwork* cachedNetwork = FindNetwork(p_yoloFolderPath, p_objectDetectorTypes, p_objectDetectorBackEnds, p_objectDetectorBlobSizes);
+
+            if (cachedNetwork != nullptr)
+            {
+                return cachedNetwork->m_network;
+            }
+        }
+
+        // Load without holding the lock so that a network being preloaded does not block requests for cached networks
+        const Network NETWORK = LoadNetwork(p_yoloFolderPath, p_objectDetectorTypes, p_objectDetectorBackEnds, p_objectDetectorBlobSizes);
+
+        const std::lock_guard<std::mutex> LOCK(m_mutex);
+
+        // Another thread may have loaded the same network in the meantime, in which case keep the one already cached
+        const CachedNetwork* cachedNetwork = FindNetwork(p_yoloFolderPath, p_objectDetectorTypes, p_objectDetectorBackEnds, p_objectDetectorBlobSizes);
+
+        if (cachedNetwork != nullptr)
+        {
+            return cachedNetwork->m_network;
+        }
+
+        if (m_cachedNetworks.size() >= Globals::G_NETWORK_CACHE_CAPACITY)
+        {
+            // Networks still held elsewhere remain valid after eviction as they are reference counted
+            m_cachedNetworks.erase(std::min_element(m_cachedNetworks.begin(), m_cachedNetworks.end(), [](const CachedNetwork& p_lhs, const CachedNetwork& p_rhs) {
+                return p_lhs.m_lastUsed < p_rhs.m_lastUsed;
+            }));
+        }
+
+        m_cachedNetworks.push_back({.m_yoloFolderPath = p_yoloFolderPath,
+                                    .m_network = NETWORK,
+                                    .m_lastUsed = ++m_useCount,
+                                    .m_objectDetectorType = p_objectDetectorTypes,
+                                    .m_objectDetectorBackEnd = p_objectDetectorBackEnds,
+                                    .m_objectDetectorBlobSize = p_objectDetectorBlobSizes});
+
+        return NETWORK;
+    }
+
+    void NetworkCache::Clear()
+    {
+        const std::lock_guard<std::mutex> LOCK(m_mutex);
+
+        m_cachedNetworks.clear();
+    }
+
+    NetworkCache::CachedNetwork* NetworkCache::FindNetwork(const std::string& p_yoloFolderPath,
+                                                           const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
+                                                           const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
+                                                           const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+    {
+        for (CachedNetwork& cachedNetwork : m_cachedNetworks)
+        {
+            if (cachedNetwork.m_objectDetectorType == p_objectDetectorTypes && cachedNetwork.m_objectDetectorBackEnd == p_objectDetectorBackEnds &&
+                cachedNetwork.m_objectDetectorBlobSize == p_objectDetectorBlobSizes && cachedNetwork.m_yoloFolderPath == p_yoloFolderPath)
+            {
+                cachedNetwork.m_lastUsed = ++m_useCount;
+                return &cachedNetwork;
+            }
+        }
+
+        return nullptr;
+    }
+
+    NetworkCache::Network NetworkCache::LoadNetwork(const std::string& p_yoloFolderPath,
+                                                    const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
+                                                    const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
+                                                    const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+    {
+        std::string modelFilePath;
+
+        switch (p_objectDetectorTypes)
+        {
+        case Globals::ObjectDetectorTypes::STANDARD:
+            modelFilePath = p_yoloFolderPath + Globals::G_YOLO_STANDARD_MODEL_NAME;
+            break;
+
+        case Globals::ObjectDetectorTypes::TINY:
+            modelFilePath = p_yoloFolderPath + Globals::G_YOLO_TINY_MODEL_NAME;
+            break;
+
+        default:
+            throw Globals::Exceptions::NotImplementedError();
+        }
+
+        Network network = {.m_net = cv::dnn::Net(), .m_modelFormat = Globals::ModelFormats::DARKNET};
+        MemoryMappedFile onnxFile;
+        ModelBundle modelBundle;
+
+        // The importers parse directly from the mapped pages instead of reading the files through streams
+        if (onnxFile.Open(modelFilePath + Globals::G_MODEL_ONNX_EXTENSION))
+        {
+            network.m_net = cv::dnn::readNetFromONNX(onnxFile.GetData(), onnxFile.GetSize());
+            network.m_modelFormat = Globals::ModelFormats::ONNX;
+        }
+
+        else if (modelBundle.Open(modelFilePath + Globals::G_MODEL_BUNDLE_EXTENSION))
+        {
+            network.m_net = cv::dnn::readNetFromDarknet(modelBundle.GetConfiguration(), modelBundle.GetConfigurationSize(), modelBundle.GetWeights(), modelBundle.GetWeightsSize());
+        }
+
+        else
+        {
+            network.m_net = cv::dnn::readNetFromDarknet(modelFilePath + Globals::G_MODEL_CFG_EXTENSION, modelFilePath + Globals::G_MODEL_WEIGHTS_EXTENSION);
+        }
+
+        cv::dnn::Net& net = network.m_net;
+
+        switch (p_objectDetectorBackEnds)
+        {
+        case Globals::ObjectDetectorBackEnds::NONE:
+            break;
+        case Globals::ObjectDetectorBackEnds::CPU:
+            net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+            net.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+            break;
+
+        case Globals::ObjectDetectorBackEnds::GPU:
+            net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+            net.setPreferableTarget(cv::dnn::DNN_TARGET_OPENCL);
+            break;
+
+        case Globals::ObjectDetectorBackEnds::CUDA:
+            net.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
+            net.setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
+            break;
+
+        case Globals::ObjectDetectorBackEnds::CPU_FP16:
+            // OpenCV falls back to the FP32 CPU target on CPUs without FP16 arithmetic
+            net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+            net.setPreferableTarget(cv::dnn::DNN_TARGET_CPU_FP16);
+            break;
+
+        case Globals::ObjectDetectorBackEnds::CPU_INT8:
+            // The quantised network keeps FP32 inputs and outputs so that the letterboxed blob and decoder are unchanged
+            net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+            net.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+            net = net.quantize(LoadCalibrationBlobs(p_yoloFolderPath, p_objectDetectorBlobSizes), CV_32F, CV_32F);
+            net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+            net.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+            break;
+
+        default:
+            throw Globals::Exceptions::NotImplementedError();
+        }
+
+        // Warm up the network so that the first frame does not pay for the layers allocating their buffers
+        const int32_t BLOB_SIZE = static_cast<int32_t>(p_objectDetectorBlobSizes);
+        const std::array<int32_t, 4> BLOB_SHAPE = {1, 3, BLOB_SIZE, BLOB_SIZE};
+        std::vector<cv::Mat> outputBlobs;
+
+        net.setInput(cv::Mat(static_cast<int32_t>(BLOB_SHAPE.size()), BLOB_SHAPE.data(), CV_32F, cv::Scalar::all(Globals::G_OBJECT_DETECTOR_LETTERBOX_PADDING)));
+        net.forward(outputBlobs, net.getUnconnectedOutLayersNames());
+
+        return network;
+    }
+
+    bool NetworkCache::HasCalibrationFrames(const std::string& p_yoloFolderPath)
+    {
+        return !GetCalibrationFramePaths(p_yoloFolderPath).empty();
+    }
+
+    std::vector<cv::Mat> NetworkCache::LoadCalibrationBlobs(const std::string& p_yoloFolderPath, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+    {
+        const std::vector<std::filesystem::path> CALIBRATION_FRAME_PATHS = GetCalibrationFramePaths(p_yoloFolderPath);
+
+        const std::size_t NUMBER_OF_FRAMES = std::min<std::size_t>(CALIBRATION_FRAME_PATHS.size(), Globals::G_OBJECT_DETECTOR_CALIBRATION_NUMBER_OF_FRAMES);
+        std::vector<cv::Mat> calibrationBlobs;
+        LetterboxPreprocessor letterboxPreprocessor;
+
+        for (std::size_t i = 0; i < NUMBER_OF_FRAMES; i++)
+        {
+            // Evenly spaced across the folder, as consecutive frames add little to the activation ranges
+            const cv::Mat FRAME = cv::imread(CALIBRATION_FRAME_PATHS[(i * CALIBRATION_FRAME_PATHS.size()) / NUMBER_OF_FRAMES].string(), cv::IMREAD_COLOR);
+
+            if (!FRAME.empty())
+            {
+                letterboxPreprocessor.Run(FRAME, static_cast<int32_t>(p_objectDetectorBlobSizes));
+                calibrationBlobs.push_back(letterboxPreprocessor.GetBlob().clone());
+            }
+        }
+
+        // This may be running on the preloading thread, so the error is thrown for the owner of the network to handle rather
+        // than exiting
+        if (calibrationBlobs.empty())
+        {
+            std::cout << std::format("\nERROR: No calibration frames for the INT8 backend were found in '{}'!\n", p_yoloFolderPath + Globals::G_OBJECT_DETECTOR_CALIBRATION_FOLDER_NAME);
+            throw Globals::Exceptions::CalibrationDataError();
+        }
+
+        return calibrationBlobs;
+    }
+
+    std::vector<std::filesystem::path> NetworkCache::GetCalibrationFramePaths(const std::string& p_yoloFolderPath)
+    {
+        const std::filesystem::path CALIBRATION_FOLDER_PATH = p_yoloFolderPath + Globals::G_OBJECT_DETECTOR_CALIBRATION_FOLDER_NAME;
+        std::vector<std::filesystem::path> calibrationFramePaths;
+
+        if (std::filesystem::is_directory(CALIBRATION_FOLDER_PATH))
+        {
+            for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(CALIBRATION_FOLDER_PATH))
+            {
+                if (entry.is_regular_file())
+                {
+                    calibrationFramePaths.push_back(entry.path());
+                }
+            }
+        }
+
+        std::sort(calibrationFramePaths.begin(), calibrationFramePaths.end());
+
+        return calibrationFramePaths;
+    }
+}
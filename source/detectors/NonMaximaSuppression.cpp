@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Globals.hpp"
+
+#include "detectors/NonMaximaSuppression.hpp"
+
+namespace LaneAndObjectDetection
+{
+    NonMaximaSuppression::NonMaximaSuppression()
+    {
+        m_sortedIndices.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_lefts.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_tops.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_rights.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_bottoms.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_areas.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_classIds.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_suppressed.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_keptIndices.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+    }
+
+    void NonMaximaSuppression::Run(const std::vector<cv::Rect>& p_boundingBoxes,
+                                   const std::vector<uint32_t>& p_classIds,
+                                   const std::vector<float>& p_confidences,
+                                   const float& p_threshold,
+                                   const bool& p_classAware,
+                                   const uint32_t& p_topK)
+    {
+        const uint32_t NUMBER_OF_CANDIDATES = static_cast<uint32_t>(p_confidences.size());
+
+        m_sortedIndices.resize(NUMBER_OF_CANDIDATES);
+        std::iota(m_sortedIndices.begin(), m_sortedIndices.end(), 0);
+
+        // Ties are broken on the index to give the same order as a stable sort, which would otherwise allocate
+        std::sort(m_sortedIndices.begin(), m_sortedIndices.end(), [&p_confidences](const uint32_t& p_lhs, const uint32_t& p_rhs) {
+            return p_confidences[p_lhs] > p_confidences[p_rhs] || (p_confidences[p_lhs] == p_confidences[p_rhs] && p_lhs < p_rhs);
+        });
+
+        m_lefts.resize(NUMBER_OF_CANDIDATES);
+        m_tops.resize(NUMBER_OF_CANDIDATES);
+        m_rights.resize(NUMBER_OF_CANDIDATES);
+        m_bottoms.resize(NUMBER_OF_CANDIDATES);
+        m_areas.resize(NUMBER_OF_CANDIDATES);
+        m_classIds.resize(NUMBER_OF_CANDIDATES);
+        m_suppressed.assign(NUMBER_OF_CANDIDATES, 0);
+
+        // Gathered in sorted order so that the candidates a kept candidate can suppress are contiguous
+        for (uint32_t i = 0; i < NUMBER_OF_CANDIDATES; i++)
+        {
+            const cv::Rect& BOUNDING_BOX = p_boundingBoxes[m_sortedIndices[i]];
+
+            m_lefts[i] = static_cast<float>(BOUNDING_BOX.x);
+            m_tops[i] = static_cast<float>(BOUNDING_BOX.y);
+            m_rights[i] = static_cast<float>(BOUNDING_BOX.x + BOUNDING_BOX.width);
+            m_bottoms[i] = static_cast<float>(BOUNDING_BOX.y + BOUNDING_BOX.height);
+            m_areas[i] = static_cast<float>(BOUNDING_BOX.area());
+            m_classIds[i] = static_cast<float>(p_classIds[m_sortedIndices[i]]);
+        }
+
+        m_keptIndices.clear();
+
+        for (uint32_t i = 0; i < NUMBER_OF_CANDIDATES; i++)
+        {
+            if (m_suppressed[i] != 0)
+            {
+                continue;
+            }
+
+            m_keptIndices.push_back(m_sortedIndices[i]);
+
+            // The remaining candidates have lower confidences so cannot be kept ahead of those already kept
+            if (m_keptIndices.size() == p_topK)
+            {
+                break;
+            }
+
+            Suppress(i, p_threshold, p_classAware);
+        }
+    }
+
+    const std::vector<uint32_t>& NonMaximaSuppression::GetKeptIndices()
+    {
+        return m_keptIndices;
+    }
+
+    void NonMaximaSuppression::Suppress(const uint32_t& p_sortedIndex, const float& p_threshold, const bool& p_classAware)
+    {
+        const int32_t NUMBER_OF_CANDIDATES = static_cast<int32_t>(m_suppressed.size());
+        const float LEFT = m_lefts[p_sortedIndex];
+        const float TOP = m_tops[p_sortedIndex];
+        const float RIGHT = m_rights[p_sortedIndex];
+        const float BOTTOM = m_bottoms[p_sortedIndex];
+        const float AREA = m_areas[p_sortedIndex];
+        const float CLASS_ID = m_classIds[p_sortedIndex];
+        int32_t index = static_cast<int32_t>(p_sortedIndex) + 1;
+
+        // Candidates far from the threshold are decided as `intersection > threshold * union` to avoid the division, whereas
+        // those near it are decided exactly as `cv::dnn::NMSBoxes` rounds them
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int32_t NUMBER_OF_LANES = cv::VTraits<cv::v_float32>::vlanes();
+        const cv::v_float32 LEFTS = cv::vx_setall_f32(LEFT);
+        const cv::v_float32 TOPS = cv::vx_setall_f32(TOP);
+        const cv::v_float32 RIGHTS = cv::vx_setall_f32(RIGHT);
+        const cv::v_float32 BOTTOMS = cv::vx_setall_f32(BOTTOM);
+        const cv::v_float32 AREAS = cv::vx_setall_f32(AREA);
+        const cv::v_float32 CLASS_IDS = cv::vx_setall_f32(CLASS_ID);
+        const cv::v_float32 LOWER_THRESHOLDS = cv::vx_setall_f32(p_threshold - Globals::G_OBJECT_DETECTOR_NMS_EXACT_MARGIN);
+        const cv::v_float32 UPPER_THRESHOLDS = cv::vx_setall_f32(p_threshold + Globals::G_OBJECT_DETECTOR_NMS_EXACT_MARGIN);
+        const cv::v_float32 ZEROS = cv::vx_setzero_f32();
+
+        for (; index <= NUMBER_OF_CANDIDATES - NUMBER_OF_LANES; index += NUMBER_OF_LANES)
+        {
+            const cv::v_float32 WIDTHS = cv::v_max(cv::v_sub(cv::v_min(cv::vx_load(m_rights.data() + index), RIGHTS), cv::v_max(cv::vx_load(m_lefts.data() + index), LEFTS)), ZEROS);
+            const cv::v_float32 HEIGHTS = cv::v_max(cv::v_sub(cv::v_min(cv::vx_load(m_bottoms.data() + index), BOTTOMS), cv::v_max(cv::vx_load(m_tops.data() + index), TOPS)), ZEROS);
+            const cv::v_float32 INTERSECTIONS = cv::v_mul(WIDTHS, HEIGHTS);
+            const cv::v_float32 UNIONS = cv::v_sub(cv::v_add(cv::vx_load(m_areas.data() + index), AREAS), INTERSECTIONS);
+
+            cv::v_float32 isOverlapping = cv::v_gt(INTERSECTIONS, cv::v_mul(UPPER_THRESHOLDS, UNIONS));
+            cv::v_float32 isNearThreshold = cv::v_and(cv::v_ge(INTERSECTIONS, cv::v_mul(LOWER_THRESHOLDS, UNIONS)), cv::v_not(isOverlapping));
+
+            if (p_classAware)
+            {
+                const cv::v_float32 IS_SAME_CLASS = cv::v_eq(cv::vx_load(m_classIds.data() + index), CLASS_IDS);
+                isOverlapping = cv::v_and(isOverlapping, IS_SAME_CLASS);
+                isNearThreshold = cv::v_and(isNearThreshold, IS_SAME_CLASS);
+            }
+
+            cv::v_store(m_suppressed.data() + index, cv::v_or(cv::vx_load(m_suppressed.data() + index), cv::v_reinterpret_as_u32(isOverlapping)));
+
+            // Rare, as jittered detections of the same object are rarely at the threshold
+            if (cv::v_check_any(isNearThreshold))
+            {
+                for (int32_t lane = index; lane < index + NUMBER_OF_LANES; lane++)
+                {
+                    const float WIDTH = std::max(std::min(m_rights[lane], RIGHT) - std::max(m_lefts[lane], LEFT), 0.0F);
+                    const float HEIGHT = std::max(std::min(m_bottoms[lane], BOTTOM) - std::max(m_tops[lane], TOP), 0.0F);
+
+                    if (IsOverlapping(m_areas[lane], AREA, WIDTH * HEIGHT, p_threshold) && (!p_classAware || m_classIds[lane] == CLASS_ID))
+                    {
+                        m_suppressed[lane] = UINT32_MAX;
+                    }
+                }
+            }
+        }
+#endif
+
+        // Scalar tail (or every candidate when SIMD is not available)
+        for (; index < NUMBER_OF_CANDIDATES; index++)
+        {
+            const float WIDTH = std::max(std::min(m_rights[index], RIGHT) - std::max(m_lefts[index], LEFT), 0.0F);
+            const float HEIGHT = std::max(std::min(m_bottoms[index], BOTTOM) - std::max(m_tops[index], TOP), 0.0F);
+
+            if (IsOverlapping(m_areas[index], AREA, WIDTH * HEIGHT, p_threshold) && (!p_classAware || m_classIds[index] == CLASS_ID))
+            {
+                m_suppressed[index] = UINT32_MAX;
+            }
+        }
+    }
+
+    bool NonMaximaSuppression::IsOverlapping(const float& p_lhsArea, const float& p_rhsArea, const float& p_intersection, const float& p_threshold)
+    {
+        // `cv::jaccardDistance` treats two empty candidates as identical
+        if (p_lhsArea + p_rhsArea <= 0.0F)
+        {
+            return 1.0F > p_threshold;
+        }
+
+        // The same sequence of roundings as `cv::dnn::NMSBoxes`, which takes the overlap as one minus the Jaccard distance
+        const double INTERSECTION = p_intersection;
+        const double JACCARD_DISTANCE = 1.0 - (INTERSECTION / (static_cast<double>(p_lhsArea) + static_cast<double>(p_rhsArea) - INTERSECTION));
+
+        return 1.0F - static_cast<float>(JACCARD_DISTANCE) > p_threshold;
+    }
+}
@@ -1,7 +1,12 @@
-#include <cfloat>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
-#include <format>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <opencv2/core.hpp>
@@ -9,6 +14,7 @@
 #include <opencv2/core/types.hpp>
 #include <opencv2/dnn/dnn.hpp>
 
+#include "helpers/FrameGeometry.hpp"
 #include "helpers/Globals.hpp"
 
 #include "detectors/ObjectDetector.hpp"
@@ -16,8 +22,17 @@
 namespace LaneAndObjectDetection
 {
     ObjectDetector::ObjectDetector() :
+        m_objectDetectionInformation(std::make_shared<ObjectDetectionInformation>()),
+        m_detectionInterval(1),
+        m_currentDetectionInterval(1),
+        m_framesUntilDetection(0),
         m_blobSize(0),
-        m_skipObjectDetection(false)
+        m_objectDetectorType(Globals::ObjectDetectorTypes::NONE),
+        m_objectDetectorBackEnd(Globals::ObjectDetectorBackEnds::NONE),
+        m_preloadedObjectDetectorType(Globals::ObjectDetectorTypes::NONE),
+        m_preloadedBlobSize(Globals::ObjectDetectorBlobSizes::NONE),
+        m_skipObjectDetection(false),
+        m_horizonCrop(false)
     {}
 
     void ObjectDetector::SetProperties(const std::string& p_yoloFolderPath,
@@ -25,54 +40,113 @@ namespace LaneAndObjectDetection
                                        const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
                                        const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
     {
-        switch (p_objectDetectorTypes)
+        // Any network still being preloaded is for the previous properties, so wait for it to finish and discard it
+        m_preloadedNet = {};
+
+        m_skipObjectDetection = p_objectDetectorTypes == Globals::ObjectDetectorTypes::NONE;
+
+        // Repeated configurations, such as the repetitions of the performance tests, reuse the cached network
+        if (!m_skipObjectDetection)
         {
-        case Globals::ObjectDetectorTypes::NONE:
-            m_skipObjectDetection = true;
-            break;
+            const NetworkCache::Network NETWORK = m_networkCache.GetNetwork(p_yoloFolderPath, p_objectDetectorTypes, p_objectDetectorBackEnds, p_objectDetectorBlobSizes);
+            m_net = NETWORK.m_net;
+            m_yoloOutputDecoder.SetModelFormat(NETWORK.m_modelFormat, static_cast<int32_t>(p_objectDetectorBlobSizes));
+        }
 
-        case Globals::ObjectDetectorTypes::STANDARD:
-            m_skipObjectDetection = false;
-            m_net = cv::dnn::readNetFromDarknet(p_yoloFolderPath + "yolov7.cfg", p_yoloFolderPath + "yolov7.weights");
-            break;
+        else
+        {
+            m_net = cv::dnn::Net();
+        }
+
+        m_yoloFolderPath = p_yoloFolderPath;
+        m_objectDetectorType = p_objectDetectorTypes;
+        m_objectDetectorBackEnd = p_objectDetectorBackEnds;
+        m_blobSize = static_cast<int32_t>(p_objectDetectorBlobSizes);
+
+        m_unconnectedOutputLayerNames = m_net.getUnconnectedOutLayersNames();
 
-        case Globals::ObjectDetectorTypes::TINY:
-            m_skipObjectDetection = false;
-            m_net = cv::dnn::readNetFromDarknet(p_yoloFolderPath + "yolov7-tiny.cfg", p_yoloFolderPath + "yolov7-tiny.weights");
-            break;
+        GetWritableInformation().m_objectInformation.clear();
+
+        m_objectTracker.Clear();
+        m_framesUntilDetection = 0;
+    }
+
+    void ObjectDetector::SetDetectionInterval(const uint32_t& p_detectionInterval)
+    {
+        m_detectionInterval = p_detectionInterval;
+        m_currentDetectionInterval = std::max(p_detectionInterval, 1U);
+        m_framesUntilDetection = 0;
+    }
+
+    uint32_t ObjectDetector::GetDetectionInterval()
+    {
+        return m_detectionInterval;
+    }
 
-        default:
-            throw Globals::Exceptions::NotImplementedError();
+    void ObjectDetector::SetHorizonCrop(const bool& p_horizonCrop)
+    {
+        m_horizonCrop = p_horizonCrop;
+    }
+
+    bool ObjectDetector::IsHorizonCropEnabled()
+    {
+        return m_horizonCrop;
+    }
+
+    void ObjectDetector::PreloadNetwork(const Globals::ObjectDetectorTypes& p_objectDetectorTypes, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+    {
+        if (m_skipObjectDetection || p_objectDetectorTypes == Globals::ObjectDetectorTypes::NONE ||
+            (p_objectDetectorTypes == m_objectDetectorType && static_cast<int32_t>(p_objectDetectorBlobSizes) == m_blobSize))
+        {
+            return;
         }
 
-        switch (p_objectDetectorBackEnds)
+        if (m_preloadedNet.valid())
         {
-        case Globals::ObjectDetectorBackEnds::NONE:
-            break;
-        case Globals::ObjectDetectorBackEnds::CPU:
-            m_net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
-            m_net.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
-            break;
+            const bool IS_SAME_NETWORK = p_objectDetectorTypes == m_preloadedObjectDetectorType && p_objectDetectorBlobSizes == m_preloadedBlobSize;
 
-        case Globals::ObjectDetectorBackEnds::GPU:
-            m_net.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
-            m_net.setPreferableTarget(cv::dnn::DNN_TARGET_OPENCL);
-            break;
+            // Replacing the future of a network that is still loading would block until it has loaded
+            if (IS_SAME_NETWORK || m_preloadedNet.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                return;
+            }
+        }
 
-        case Globals::ObjectDetectorBackEnds::CUDA:
-            m_net.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
-            m_net.setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
-            break;
+        m_preloadedObjectDetectorType = p_objectDetectorTypes;
+        m_preloadedBlobSize = p_objectDetectorBlobSizes;
+        m_preloadedNet = std::async(std::launch::async, &NetworkCache::GetNetwork, &m_networkCache, m_yoloFolderPath, p_objectDetectorTypes, m_objectDetectorBackEnd, p_objectDetectorBlobSizes);
+    }
 
-        default:
-            throw Globals::Exceptions::NotImplementedError();
+    bool ObjectDetector::SwitchNetwork(const Globals::ObjectDetectorTypes& p_objectDetectorTypes, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+    {
+        if (m_skipObjectDetection || p_objectDetectorTypes == Globals::ObjectDetectorTypes::NONE)
+        {
+            return false;
         }
 
-        m_blobSize = static_cast<int32_t>(p_objectDetectorBlobSizes);
+        if (p_objectDetectorTypes == m_objectDetectorType && static_cast<int32_t>(p_objectDetectorBlobSizes) == m_blobSize)
+        {
+            return true;
+        }
+
+        PreloadNetwork(p_objectDetectorTypes, p_objectDetectorBlobSizes);
+
+        if (p_objectDetectorTypes != m_preloadedObjectDetectorType || p_objectDetectorBlobSizes != m_preloadedBlobSize ||
+            m_preloadedNet.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return false;
+        }
 
+        // The tracked objects are in frame co-ordinates so remain valid across the switch. Any error while preloading is
+        // rethrown by `get()` on this thread.
+        const NetworkCache::Network NETWORK = m_preloadedNet.get();
+        m_net = NETWORK.m_net;
+        m_objectDetectorType = p_objectDetectorTypes;
+        m_blobSize = static_cast<int32_t>(p_objectDetectorBlobSizes);
+        m_yoloOutputDecoder.SetModelFormat(NETWORK.m_modelFormat, m_blobSize);
         m_unconnectedOutputLayerNames = m_net.getUnconnectedOutLayersNames();
 
-        m_objectDetectionInformation.m_objectInformation.clear();
+        return true;
     }
 
     void ObjectDetector::RunObjectDetector(const cv::Mat& p_frame)
@@ -82,63 +156,245 @@ namespace LaneAndObjectDetection
             return;
         }
 
-        m_objectDetectionInformation.m_objectInformation.clear();
+        // Propagate the tracked objects on the frames between detections
+        if (m_framesUntilDetection > 0)
+        {
+            m_framesUntilDetection--;
+            m_objectTracker.Predict(GetWritableInformation());
+            return;
+        }
+
+        UpdateFrameGeometry(p_frame.size());
+
+        // Get output blobs from the letterboxed frame
+        m_letterboxPreprocessor.Run(p_frame, m_blobSize);
+        m_net.setInput(m_letterboxPreprocessor.GetBlob());
+        m_net.forward(m_outputBlobs, m_unconnectedOutputLayerNames);
+
+        ObjectDetectionInformation& objectDetectionInformation = GetWritableInformation();
+
+        if (m_horizonCrop)
+        {
+            m_initialObjectClassIds.clear();
+            m_initialObjectBoundingBoxes.clear();
+            m_initialObjectConfidences.clear();
+
+            AppendCandidates(m_outputBlobs, m_letterboxPreprocessor, cv::Rect(cv::Point(0, 0), m_frameGeometry.m_frameSize));
+
+            // The candidates of the full frame have been decoded, so its output blobs can be overwritten by the second pass
+            const cv::Rect HORIZON_CROP = GetHorizonCrop();
+
+            m_horizonCropPreprocessor.Run(p_frame(HORIZON_CROP), m_blobSize);
+            m_net.setInput(m_horizonCropPreprocessor.GetBlob());
+            m_net.forward(m_outputBlobs, m_unconnectedOutputLayerNames);
+
+            AppendCandidates(m_outputBlobs, m_horizonCropPreprocessor, HORIZON_CROP);
+
+            // Objects found by both passes are merged by keeping the more confident of the two
+            SelectObjects(objectDetectionInformation);
+        }
+
+        else
+        {
+            DecodeOutputBlobs(m_outputBlobs, objectDetectionInformation);
+        }
 
-        // Get output blobs from the frame
-        std::vector<cv::Mat> outputBlobs;
-        const cv::Mat BLOB_FROM_IMAGE = cv::dnn::blobFromImage(p_frame, Globals::G_OBJECT_DETECTOR_SCALE_FACTOR, cv::Size(m_blobSize, m_blobSize), Globals::G_COLOUR_BLACK);
-        m_net.setInput(BLOB_FROM_IMAGE);
-        m_net.forward(outputBlobs, m_unconnectedOutputLayerNames);
+        // The tracker is only needed to fill the frames between detections
+        if (m_detectionInterval == 1)
+        {
+            return;
+        }
 
-        // Go through all output blobs and only allow those with confidence above threshold
-        std::vector<std::string> initialObjectNames;
-        std::vector<cv::Rect> initialObjectBoundingBoxes;
-        std::vector<float> initialObjectConfidences;
-        cv::Point maxConfidenceObjectIndex;
-        double maxConfidence = -DBL_MAX;
+        const double TRACKER_AGREEMENT = m_objectTracker.Update(objectDetectionInformation);
 
-        for (auto& outputBlob : outputBlobs)
+        if (m_detectionInterval == Globals::G_OBJECT_DETECTOR_ADAPTIVE_INTERVAL)
         {
-            for (int32_t rowIndex = 0; rowIndex < outputBlob.rows; rowIndex++)
+            m_currentDetectionInterval = TRACKER_AGREEMENT >= Globals::G_OBJECT_DETECTOR_ADAPTIVE_AGREEMENT_THRESHOLD ? std::min(m_currentDetectionInterval + 1, Globals::G_OBJECT_DETECTOR_MAXIMUM_ADAPTIVE_INTERVAL) : 1;
+        }
+
+        m_framesUntilDetection = m_currentDetectionInterval - 1;
+    }
+
+    void ObjectDetector::RunObjectDetector(const std::vector<cv::Mat>& p_frames, std::vector<ObjectDetectionInformation>& p_objectDetectionInformation)
+    {
+        p_objectDetectionInformation.resize(p_frames.size());
+
+        if (m_skipObjectDetection || p_frames.empty())
+        {
+            for (ObjectDetectionInformation& objectDetectionInformation : p_objectDetectionInformation)
+            {
+                objectDetectionInformation.m_objectInformation.clear();
+            }
+
+            return;
+        }
+
+        // The frames of a batch all come from the same input so share the same size
+        UpdateFrameGeometry(p_frames.front().size());
+
+        // Get output blobs from all letterboxed frames at once
+        m_letterboxPreprocessor.Run(p_frames, m_blobSize);
+        m_net.setInput(m_letterboxPreprocessor.GetBlob());
+        m_net.forward(m_outputBlobs, m_unconnectedOutputLayerNames);
+
+        const int32_t BATCH_SIZE = static_cast<int32_t>(p_frames.size());
+        m_frameOutputBlobs.resize(m_outputBlobs.size());
+
+        for (int32_t batchIndex = 0; batchIndex < BATCH_SIZE; batchIndex++)
+        {
+            // Scatter the output blobs back to each frame. Batched outputs are either [batch, rows, cols] or have the rows of
+            // each frame stacked one after another, so take a 2D view (no copy) of the rows belonging to this frame.
+            for (uint32_t i = 0; i < m_outputBlobs.size(); i++)
             {
-                // Each row is structured as the following [cx, cy, w, h, box score, object 1 score, object 2 score, ..., object n score]
+                cv::Mat& outputBlob = m_outputBlobs[i];
 
-                // minMaxLoc returns the object index that has the maximum confidence as well as the maximum confidence
-                cv::minMaxLoc(outputBlob.row(rowIndex).colRange(Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECT_SCORES_START_INDEX, outputBlob.cols), nullptr, &maxConfidence, nullptr, &maxConfidenceObjectIndex);
+                if (outputBlob.dims == 3)
+                {
+                    m_frameOutputBlobs[i] = cv::Mat(outputBlob.size[1], outputBlob.size[2], CV_32F, outputBlob.ptr<float>(batchIndex));
+                }
 
-                if (maxConfidence > Globals::G_OBJECT_DETECTOR_CONFIDENCE_THRESHOLD)
+                else
                 {
-                    const double CENTER_X = outputBlob.at<float>(rowIndex, Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_CENTER_X_COORD_INDEX) * Globals::G_VIDEO_INPUT_WIDTH;
-                    const double CENTER_Y = outputBlob.at<float>(rowIndex, Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_CENTER_Y_COORD_INDEX) * Globals::G_VIDEO_INPUT_HEIGHT;
-                    const double WIDTH = (outputBlob.at<float>(rowIndex, Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_WIDTH_INDEX) * Globals::G_VIDEO_INPUT_WIDTH) + Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_BUFFER;
-                    const double HEIGHT = (outputBlob.at<float>(rowIndex, Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_HEIGHT_INDEX) * Globals::G_VIDEO_INPUT_HEIGHT) + Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_BUFFER;
-
-                    // Remove object detections on the hood of car
-                    if (CENTER_Y < Globals::G_ROI_BOTTOM_HEIGHT)
-                    {
-                        initialObjectNames.push_back(Globals::G_OBJECT_DETECTOR_OBJECT_NAMES.at(maxConfidenceObjectIndex.x));
-                        initialObjectBoundingBoxes.emplace_back(CENTER_X - (WIDTH / Globals::G_DIVIDE_BY_TWO), CENTER_Y - (HEIGHT / Globals::G_DIVIDE_BY_TWO), WIDTH, HEIGHT);
-                        initialObjectConfidences.push_back(static_cast<float>(maxConfidence));
-                    }
+                    const int32_t ROWS_PER_FRAME = outputBlob.rows / BATCH_SIZE;
+                    m_frameOutputBlobs[i] = outputBlob.rowRange(batchIndex * ROWS_PER_FRAME, (batchIndex + 1) * ROWS_PER_FRAME);
                 }
             }
+
+            DecodeOutputBlobs(m_frameOutputBlobs, p_objectDetectionInformation[batchIndex]);
+        }
+
+        GetWritableInformation() = p_objectDetectionInformation.back();
+    }
+
+    void ObjectDetector::DecodeOutputBlobs(const std::vector<cv::Mat>& p_outputBlobs, ObjectDetectionInformation& p_objectDetectionInformation)
+    {
+        m_initialObjectClassIds.clear();
+        m_initialObjectBoundingBoxes.clear();
+        m_initialObjectConfidences.clear();
+
+        AppendCandidates(p_outputBlobs, m_letterboxPreprocessor, cv::Rect(cv::Point(0, 0), m_frameGeometry.m_frameSize));
+        SelectObjects(p_objectDetectionInformation);
+    }
+
+    void ObjectDetector::AppendCandidates(const std::vector<cv::Mat>& p_outputBlobs, LetterboxPreprocessor& p_letterboxPreprocessor, const cv::Rect& p_region)
+    {
+        // Decode the rows of all output blobs with a confidence above the threshold
+        m_yoloOutputDecoder.Clear();
+
+        for (const cv::Mat& outputBlob : p_outputBlobs)
+        {
+            m_yoloOutputDecoder.Decode(outputBlob, static_cast<float>(Globals::G_OBJECT_DETECTOR_CONFIDENCE_THRESHOLD));
+        }
+
+        const YoloOutputDecoder::Candidates& CANDIDATES = m_yoloOutputDecoder.GetCandidates();
+
+        // Only the edges of the region that are inside the frame cut objects off, whereas objects at the edges of the frame
+        // can extend past them
+        const double BORDER = Globals::G_OBJECT_DETECTOR_HORIZON_CROP_BORDER;
+        const double MINIMUM_X = p_region.x > 0 ? BORDER : std::numeric_limits<double>::lowest();
+        const double MINIMUM_Y = p_region.y > 0 ? BORDER : std::numeric_limits<double>::lowest();
+        const double MAXIMUM_X = p_region.br().x < m_frameGeometry.m_frameSize.width ? p_region.width - BORDER : std::numeric_limits<double>::max();
+        const double MAXIMUM_Y = p_region.br().y < m_frameGeometry.m_frameSize.height ? p_region.height - BORDER : std::numeric_limits<double>::max();
+
+        // The hood of the car is scaled from the reference resolution so that it holds at any resolution
+        const int32_t HOOD_Y = m_frameGeometry.FromReference(cv::Point(0, Globals::G_ROI_BOTTOM_HEIGHT)).y;
+
+        for (uint32_t i = 0; i < CANDIDATES.m_classIds.size(); i++)
+        {
+            // The candidates are normalised to the letterboxed blob so are mapped back to the region
+            const cv::Rect2d BOUNDING_BOX = p_letterboxPreprocessor.ToFrameBoundingBox(CANDIDATES.m_centerX[i], CANDIDATES.m_centerY[i], CANDIDATES.m_widths[i], CANDIDATES.m_heights[i]);
+
+            if (BOUNDING_BOX.x < MINIMUM_X || BOUNDING_BOX.y < MINIMUM_Y || BOUNDING_BOX.br().x > MAXIMUM_X || BOUNDING_BOX.br().y > MAXIMUM_Y)
+            {
+                continue;
+            }
+
+            const double CENTER_X = p_region.x + BOUNDING_BOX.x + (BOUNDING_BOX.width / Globals::G_DIVIDE_BY_TWO);
+            const double CENTER_Y = p_region.y + BOUNDING_BOX.y + (BOUNDING_BOX.height / Globals::G_DIVIDE_BY_TWO);
+            const double WIDTH = BOUNDING_BOX.width + Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_BUFFER;
+            const double HEIGHT = BOUNDING_BOX.height + Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_BUFFER;
+
+            // Remove object detections on the hood of car
+            if (CENTER_Y < HOOD_Y)
+            {
+                m_initialObjectClassIds.push_back(CANDIDATES.m_classIds[i]);
+                m_initialObjectBoundingBoxes.emplace_back(CENTER_X - (WIDTH / Globals::G_DIVIDE_BY_TWO), CENTER_Y - (HEIGHT / Globals::G_DIVIDE_BY_TWO), WIDTH, HEIGHT);
+                m_initialObjectConfidences.push_back(CANDIDATES.m_confidences[i]);
+            }
         }
+    }
+
+    void ObjectDetector::SelectObjects(ObjectDetectionInformation& p_objectDetectionInformation)
+    {
+        p_objectDetectionInformation.m_objectInformation.clear();
 
         // Apply non-maxima suppression to suppress overlapping bounding boxes for objects that overlap, the highest confidence object will be chosen
-        std::vector<int> nonMaximaSuppressedFilteredIndicies;
+        m_nonMaximaSuppression.Run(m_initialObjectBoundingBoxes,
+                                   m_initialObjectClassIds,
+                                   m_initialObjectConfidences,
+                                   static_cast<float>(Globals::G_OBJECT_DETECTOR_NMS_THRESHOLD),
+                                   Globals::G_OBJECT_DETECTOR_NMS_CLASS_AWARE,
+                                   Globals::G_OBJECT_DETECTOR_NMS_TOP_K);
 
-        cv::dnn::NMSBoxes(initialObjectBoundingBoxes, initialObjectConfidences, 0.0, static_cast<float>(Globals::G_OBJECT_DETECTOR_NMS_THRESHOLD), nonMaximaSuppressedFilteredIndicies);
+        for (const uint32_t& index : m_nonMaximaSuppression.GetKeptIndices())
+        {
+            p_objectDetectionInformation.m_objectInformation.push_back({.m_boundingBox = m_initialObjectBoundingBoxes[index],
+                                                                        .m_boundingBoxColour = Globals::G_OBJECT_DETECTOR_OBJECT_NAMES_AND_COLOURS.at(Globals::G_OBJECT_DETECTOR_OBJECT_NAMES.at(m_initialObjectClassIds[index])),
+                                                                        .m_classId = m_initialObjectClassIds[index],
+                                                                        .m_confidence = m_initialObjectConfidences[index]});
+        }
+    }
 
-        for (const int32_t& index : nonMaximaSuppressedFilteredIndicies)
+    void ObjectDetector::UpdateFrameGeometry(const cv::Size& p_frameSize)
+    {
+        if (p_frameSize != m_frameGeometry.m_frameSize)
         {
-            m_objectDetectionInformation.m_objectInformation.push_back({.m_boundingBox = initialObjectBoundingBoxes.at(index),
-                                                                        .m_boundingBoxColour = Globals::G_OBJECT_DETECTOR_OBJECT_NAMES_AND_COLOURS.at(initialObjectNames.at(index)),
-                                                                        .m_objectName = std::format("{} ({} %)", initialObjectNames.at(index), std::to_string(static_cast<uint32_t>(initialObjectConfidences.at(index) * Globals::G_CONVERT_DECIMAL_TO_PERCENTAGE)))});
+            m_frameGeometry = FrameGeometry(p_frameSize);
         }
     }
 
-    ObjectDetectionInformation ObjectDetector::GetInformation()
+    cv::Rect ObjectDetector::GetHorizonCrop()
+    {
+        // The crop is square so its size is scaled with the height of the frame, the same as the top of the region-of-interest
+        const int32_t SIZE = std::min({m_frameGeometry.FromReference(cv::Point(0, Globals::G_OBJECT_DETECTOR_HORIZON_CROP_SIZE)).y, m_frameGeometry.m_frameSize.width, m_frameGeometry.m_frameSize.height});
+        const int32_t CENTER_Y = m_frameGeometry.FromReference(cv::Point(0, Globals::G_ROI_TOP_HEIGHT)).y;
+
+        // Shifted rather than clipped at the bottom of the frame so that the crop stays square and fills the blob
+        const int32_t X = (m_frameGeometry.m_frameSize.width - SIZE) / 2;
+        const int32_t Y = std::clamp(CENTER_Y - (SIZE / 2), 0, m_frameGeometry.m_frameSize.height - SIZE);
+
+        return {X, Y, SIZE, SIZE};
+    }
+
+    const ObjectDetectionInformation& ObjectDetector::GetInformation()
+    {
+        return *m_objectDetectionInformation;
+    }
+
+    std::shared_ptr<const ObjectDetectionInformation> ObjectDetector::GetInformationSnapshot()
     {
         return m_objectDetectionInformation;
     }
+
+    ObjectDetectionInformation& ObjectDetector::GetWritableInformation()
+    {
+        // Only this thread can create new references so a use count of one means that there are no other holders
+        if (m_objectDetectionInformation.use_count() > 1)
+        {
+            // The held struct is swapped in to the pool for a struct that is no longer held, which keeps the capacity of its
+            // vectors. A new struct is only created while the pool grows to the number of snapshots held at once.
+            auto freeInformation = std::ranges::find_if(m_objectDetectionInformationPool, [](const std::shared_ptr<ObjectDetectionInformation>& p_information) { return p_information.use_count() == 1; });
+
+            if (freeInformation == m_objectDetectionInformationPool.end())
+            {
+                m_objectDetectionInformationPool.push_back(std::make_shared<ObjectDetectionInformation>());
+                freeInformation = std::prev(m_objectDetectionInformationPool.end());
+            }
+
+            std::swap(m_objectDetectionInformation, *freeInformation);
+            m_objectDetectionInformation->m_objectInformation.clear();
+        }
+
+        return *m_objectDetectionInformation;
+    }
 }
@@ -0,0 +1,87 @@
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "helpers/FrameGeometry.hpp"
+#include "helpers/Globals.hpp"
+#include "helpers/Information.hpp"
+
+#include "detectors/ObjectOccupancyMask.hpp"
+
+namespace LaneAndObjectDetection
+{
+    ObjectOccupancyMask::ObjectOccupancyMask()
+    {
+        m_setRegions.reserve(Globals::G_OBJECT_DETECTOR_NMS_TOP_K);
+        m_boundingBoxes.reserve(Globals::G_OBJECT_DETECTOR_NMS_TOP_K);
+    }
+
+    void ObjectOccupancyMask::SetRegion(const cv::Rect& p_region)
+    {
+        m_region = p_region;
+
+        // One larger than the region as the bounding boxes, and the points checked against them, include the far edges
+        m_mask = cv::Mat::zeros(p_region.height + 1, p_region.width + 1, CV_8UC1);
+        m_setRegions.clear();
+    }
+
+    void ObjectOccupancyMask::Update(const ObjectDetectionInformation& p_objectDetectionInformation, const FrameGeometry& p_frameGeometry)
+    {
+        for (const cv::Rect& setRegion : m_setRegions)
+        {
+            m_mask(setRegion).setTo(0);
+        }
+
+        m_setRegions.clear();
+        m_boundingBoxes.clear();
+
+        const cv::Rect MASK_REGION = cv::Rect(cv::Point(0, 0), m_mask.size());
+
+        for (const ObjectDetectionInformation::DetectedObjectInformation& detectedObjectInformation : p_objectDetectionInformation.m_objectInformation)
+        {
+            // The bounding boxes are in frame co-ordinates while the mask is in reference co-ordinates
+            const cv::Point TOP_LEFT = p_frameGeometry.ToReference(detectedObjectInformation.m_boundingBox.tl());
+            const cv::Point BOTTOM_RIGHT = p_frameGeometry.ToReference(detectedObjectInformation.m_boundingBox.br());
+
+            m_boundingBoxes.emplace_back(TOP_LEFT.x, TOP_LEFT.y, BOTTOM_RIGHT.x - TOP_LEFT.x, BOTTOM_RIGHT.y - TOP_LEFT.y);
+
+            // A bounding box whose corners cross after rounding contains no points
+            if (TOP_LEFT.x > BOTTOM_RIGHT.x || TOP_LEFT.y > BOTTOM_RIGHT.y)
+            {
+                continue;
+            }
+
+            const cv::Rect SET_REGION = cv::Rect(TOP_LEFT - m_region.tl(), BOTTOM_RIGHT - m_region.tl() + cv::Point(1, 1)) & MASK_REGION;
+
+            if (!SET_REGION.empty())
+            {
+                m_mask(SET_REGION).setTo(1);
+                m_setRegions.push_back(SET_REGION);
+            }
+        }
+    }
+
+    bool ObjectOccupancyMask::IsOccupied(const cv::Point& p_point)
+    {
+        const cv::Point MASK_POINT = p_point - m_region.tl();
+
+        if (MASK_POINT.x >= 0 && MASK_POINT.x < m_mask.cols && MASK_POINT.y >= 0 && MASK_POINT.y < m_mask.rows)
+        {
+            return m_mask.at<uint8_t>(MASK_POINT.y, MASK_POINT.x) != 0;
+        }
+
+        // Points outside of the mask are rare, so are checked against each bounding box instead
+        for (const cv::Rect& boundingBox : m_boundingBoxes)
+        {
+            if (p_point.x >= boundingBox.x && p_point.x <= boundingBox.x + boundingBox.width && p_point.y >= boundingBox.y && p_point.y <= boundingBox.y + boundingBox.height)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
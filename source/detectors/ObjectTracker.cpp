@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <opencv2/core/matx.hpp>
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Globals.hpp"
+#include "helpers/Information.hpp"
+
+#include "detectors/ObjectTracker.hpp"
+
+namespace LaneAndObjectDetection
+{
+    ObjectTracker::ObjectTracker()
+    {
+        m_tracks.reserve(Globals::G_OBJECT_TRACKER_INITIAL_CAPACITY);
+        m_updatedTracks.reserve(Globals::G_OBJECT_TRACKER_INITIAL_CAPACITY);
+        m_trackAssociated.reserve(Globals::G_OBJECT_TRACKER_INITIAL_CAPACITY);
+    }
+
+    double ObjectTracker::Update(const ObjectDetectionInformation& p_objectDetectionInformation)
+    {
+        // The tracks were last advanced to the previous frame
+        for (Track& track : m_tracks)
+        {
+            Advance(track);
+        }
+
+        m_trackAssociated.assign(m_tracks.size(), 0);
+        m_updatedTracks.clear();
+
+        double totalIntersectionOverUnion = 0;
+
+        // Detections are in descending order of confidence so the most confident detections are associated first
+        for (const ObjectDetectionInformation::DetectedObjectInformation& objectInformation : p_objectDetectionInformation.m_objectInformation)
+        {
+            const cv::Rect2d DETECTED_BOUNDING_BOX = objectInformation.m_boundingBox;
+
+            int32_t bestTrackIndex = -1;
+            double bestIntersectionOverUnion = Globals::G_OBJECT_TRACKER_IOU_THRESHOLD;
+
+            for (uint32_t i = 0; i < m_tracks.size(); i++)
+            {
+                if (static_cast<bool>(m_trackAssociated[i]) || m_tracks[i].m_classId != objectInformation.m_classId)
+                {
+                    continue;
+                }
+
+                const double INTERSECTION_OVER_UNION = IntersectionOverUnion(m_tracks[i].m_boundingBox, DETECTED_BOUNDING_BOX);
+
+                if (INTERSECTION_OVER_UNION >= bestIntersectionOverUnion)
+                {
+                    bestTrackIndex = static_cast<int32_t>(i);
+                    bestIntersectionOverUnion = INTERSECTION_OVER_UNION;
+                }
+            }
+
+            Track updatedTrack = {.m_boundingBox = DETECTED_BOUNDING_BOX,
+                                  .m_detectedBoundingBox = DETECTED_BOUNDING_BOX,
+                                  .m_velocity = cv::Vec4d(0, 0, 0, 0),
+                                  .m_boundingBoxColour = objectInformation.m_boundingBoxColour,
+                                  .m_classId = objectInformation.m_classId,
+                                  .m_confidence = objectInformation.m_confidence,
+                                  .m_framesSinceDetection = 0};
+
+            if (bestTrackIndex >= 0)
+            {
+                const Track& PREVIOUS_TRACK = m_tracks[bestTrackIndex];
+                m_trackAssociated[bestTrackIndex] = 1;
+                totalIntersectionOverUnion += bestIntersectionOverUnion;
+
+                // Blend the velocity measured since the last detection in to the previous velocity to smooth out jitter in
+                // the detected bounding boxes
+                const double FRAMES = std::max(PREVIOUS_TRACK.m_framesSinceDetection, 1U);
+                const cv::Vec4d MEASURED_VELOCITY = cv::Vec4d((DETECTED_BOUNDING_BOX.x - PREVIOUS_TRACK.m_detectedBoundingBox.x) / FRAMES,
+                                                              (DETECTED_BOUNDING_BOX.y - PREVIOUS_TRACK.m_detectedBoundingBox.y) / FRAMES,
+                                                              (DETECTED_BOUNDING_BOX.width - PREVIOUS_TRACK.m_detectedBoundingBox.width) / FRAMES,
+                                                              (DETECTED_BOUNDING_BOX.height - PREVIOUS_TRACK.m_detectedBoundingBox.height) / FRAMES);
+
+                updatedTrack.m_velocity = (MEASURED_VELOCITY * Globals::G_OBJECT_TRACKER_VELOCITY_SMOOTHING) + (PREVIOUS_TRACK.m_velocity * (1 - Globals::G_OBJECT_TRACKER_VELOCITY_SMOOTHING));
+            }
+
+            m_updatedTracks.push_back(updatedTrack);
+        }
+
+        // Both lost tracks and new detections count against the agreement as neither was predicted
+        const std::size_t NUMBER_OF_OBJECTS = std::max(m_tracks.size(), m_updatedTracks.size());
+
+        std::swap(m_tracks, m_updatedTracks);
+
+        return NUMBER_OF_OBJECTS == 0 ? 1 : totalIntersectionOverUnion / static_cast<double>(NUMBER_OF_OBJECTS);
+    }
+
+    void ObjectTracker::Predict(ObjectDetectionInformation& p_objectDetectionInformation)
+    {
+        p_objectDetectionInformation.m_objectInformation.clear();
+
+        for (Track& track : m_tracks)
+        {
+            Advance(track);
+
+            p_objectDetectionInformation.m_objectInformation.push_back({.m_boundingBox = track.m_boundingBox,
+                                                                        .m_boundingBoxColour = track.m_boundingBoxColour,
+                                                                        .m_classId = track.m_classId,
+                                                                        .m_confidence = track.m_confidence});
+        }
+    }
+
+    void ObjectTracker::Clear()
+    {
+        m_tracks.clear();
+    }
+
+    void ObjectTracker::Advance(Track& p_track)
+    {
+        // The size is kept positive so that a shrinking object does not invert its bounding box
+        p_track.m_boundingBox.x += p_track.m_velocity[0];
+        p_track.m_boundingBox.y += p_track.m_velocity[1];
+        p_track.m_boundingBox.width = std::max(p_track.m_boundingBox.width + p_track.m_velocity[2], 1.0);
+        p_track.m_boundingBox.height = std::max(p_track.m_boundingBox.height + p_track.m_velocity[3], 1.0);
+        p_track.m_framesSinceDetection++;
+    }
+
+    double ObjectTracker::IntersectionOverUnion(const cv::Rect2d& p_lhs, const cv::Rect2d& p_rhs)
+    {
+        const double INTERSECTION_AREA = (p_lhs & p_rhs).area();
+        const double UNION_AREA = p_lhs.area() + p_rhs.area() - INTERSECTION_AREA;
+
+        return UNION_AREA > 0 ? INTERSECTION_AREA / UNION_AREA : 0;
+    }
+}
@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cstdint>
+#include <numeric>
+
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/core/mat.hpp>
+
+#include "helpers/Globals.hpp"
+
+#include "detectors/YoloOutputDecoder.hpp"
+
+namespace LaneAndObjectDetection
+{
+    YoloOutputDecoder::YoloOutputDecoder() :
+        m_boundingBoxScale(1),
+        m_scoresIncludeObjectness(true)
+    {
+        m_candidates.m_classIds.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_candidates.m_confidences.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_candidates.m_centerX.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_candidates.m_centerY.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_candidates.m_widths.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+        m_candidates.m_heights.reserve(Globals::G_YOLO_OUTPUT_DECODER_INITIAL_CAPACITY);
+    }
+
+    void YoloOutputDecoder::Clear()
+    {
+        m_candidates.m_classIds.clear();
+        m_candidates.m_confidences.clear();
+        m_candidates.m_centerX.clear();
+        m_candidates.m_centerY.clear();
+        m_candidates.m_widths.clear();
+        m_candidates.m_heights.clear();
+    }
+
+    void YoloOutputDecoder::SetModelFormat(const Globals::ModelFormats& p_modelFormat, const int32_t& p_blobSize)
+    {
+        switch (p_modelFormat)
+        {
+        case Globals::ModelFormats::DARKNET:
+            m_boundingBoxScale = 1;
+            m_scoresIncludeObjectness = true;
+            break;
+
+        case Globals::ModelFormats::ONNX:
+            m_boundingBoxScale = 1.0F / static_cast<float>(std::max(p_blobSize, 1));
+            m_scoresIncludeObjectness = false;
+            break;
+
+        default:
+            throw Globals::Exceptions::NotImplementedError();
+        }
+    }
+
+    void YoloOutputDecoder::Decode(const cv::Mat& p_outputBlob, const float& p_confidenceThreshold)
+    {
+        // ONNX models output a single [1, rows, columns] blob, so take a 2D view (no copy) of it
+        const cv::Mat OUTPUT_BLOB = p_outputBlob.dims == 3 ? p_outputBlob.reshape(1, {p_outputBlob.size[1], p_outputBlob.size[2]}) : p_outputBlob;
+        const int32_t NUMBER_OF_SCORES = OUTPUT_BLOB.cols - Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECT_SCORES_START_INDEX;
+
+        for (int32_t rowIndex = 0; rowIndex < OUTPUT_BLOB.rows; rowIndex++)
+        {
+            const float* ROW = OUTPUT_BLOB.ptr<float>(rowIndex);
+
+            // The class scores have already been multiplied by the objectness score so none of them can be above the threshold
+            // if the objectness score is not, which is the case for the vast majority of rows
+            if (ROW[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECTNESS_INDEX] <= p_confidenceThreshold)
+            {
+                continue;
+            }
+
+            float maxScore = 0;
+            const int32_t CLASS_ID = ArgMax(ROW + Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECT_SCORES_START_INDEX, NUMBER_OF_SCORES, maxScore);
+
+            // Scaling every class score by the same objectness score does not change which is the highest
+            if (!m_scoresIncludeObjectness)
+            {
+                maxScore *= ROW[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECTNESS_INDEX];
+            }
+
+            if (maxScore > p_confidenceThreshold)
+            {
+                m_candidates.m_classIds.push_back(static_cast<uint32_t>(CLASS_ID));
+                m_candidates.m_confidences.push_back(maxScore);
+                m_candidates.m_centerX.push_back(ROW[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_CENTER_X_COORD_INDEX] * m_boundingBoxScale);
+                m_candidates.m_centerY.push_back(ROW[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_CENTER_Y_COORD_INDEX] * m_boundingBoxScale);
+                m_candidates.m_widths.push_back(ROW[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_WIDTH_INDEX] * m_boundingBoxScale);
+                m_candidates.m_heights.push_back(ROW[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_HEIGHT_INDEX] * m_boundingBoxScale);
+            }
+        }
+    }
+
+    const YoloOutputDecoder::Candidates& YoloOutputDecoder::GetCandidates()
+    {
+        return m_candidates;
+    }
+
+    int32_t YoloOutputDecoder::ArgMax(const float* p_scores, const int32_t& p_numberOfScores, float& p_maxScore)
+    {
+        int32_t maxIndex = 0;
+        float maxScore = -FLT_MAX;
+        int32_t index = 0;
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int32_t NUMBER_OF_LANES = cv::VTraits<cv::v_float32>::vlanes();
+
+        if (p_numberOfScores >= NUMBER_OF_LANES)
+        {
+            std::array<int32_t, cv::VTraits<cv::v_int32>::max_nlanes> laneIndices {};
+            std::iota(laneIndices.begin(), laneIndices.end(), 0);
+
+            cv::v_int32 currentIndices = cv::vx_load(laneIndices.data());
+            const cv::v_int32 INDEX_STEP = cv::vx_setall_s32(NUMBER_OF_LANES);
+
+            cv::v_float32 laneMaxScores = cv::vx_setall_f32(-FLT_MAX);
+            cv::v_int32 laneMaxIndices = cv::vx_setall_s32(0);
+
+            // Each lane keeps the first occurrence of its highest score as the comparison is strict
+            for (; index <= p_numberOfScores - NUMBER_OF_LANES; index += NUMBER_OF_LANES)
+            {
+                const cv::v_float32 SCORES = cv::vx_load(p_scores + index);
+                const cv::v_float32 IS_GREATER = cv::v_gt(SCORES, laneMaxScores);
+
+                laneMaxScores = cv::v_select(IS_GREATER, SCORES, laneMaxScores);
+                laneMaxIndices = cv::v_select(cv::v_reinterpret_as_s32(IS_GREATER), currentIndices, laneMaxIndices);
+                currentIndices = cv::v_add(currentIndices, INDEX_STEP);
+            }
+
+            std::array<float, cv::VTraits<cv::v_float32>::max_nlanes> laneMaxScoresBuffer {};
+            std::array<int32_t, cv::VTraits<cv::v_int32>::max_nlanes> laneMaxIndicesBuffer {};
+            cv::v_store(laneMaxScoresBuffer.data(), laneMaxScores);
+            cv::v_store(laneMaxIndicesBuffer.data(), laneMaxIndices);
+
+            // Reduce across the lanes, preferring the lowest index when lanes share the highest score
+            for (int32_t lane = 0; lane < NUMBER_OF_LANES; lane++)
+            {
+                if (laneMaxScoresBuffer[lane] > maxScore || (laneMaxScoresBuffer[lane] == maxScore && laneMaxIndicesBuffer[lane] < maxIndex))
+                {
+                    maxScore = laneMaxScoresBuffer[lane];
+                    maxIndex = laneMaxIndicesBuffer[lane];
+                }
+            }
+        }
+#endif
+
+        // Scalar tail (or the whole search when SIMD is not available), all indices here are higher than those searched above
+        for (; index < p_numberOfScores; index++)
+        {
+            if (p_scores[index] > maxScore)
+            {
+                maxScore = p_scores[index];
+                maxIndex = index;
+            }
+        }
+
+        p_maxScore = maxScore;
+
+        return maxIndex;
+    }
+}
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <opencv2/highgui.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "helpers/Globals.hpp"
+#include "helpers/Information.hpp"
+
+#include "helpers/DebugVisualiser.hpp"
+
+namespace LaneAndObjectDetection
+{
+    DebugVisualiser::DebugVisualiser() :
+        m_debuggingFrameSize(static_cast<int32_t>(Globals::G_ROI_BOUNDING_BOX_SIZE.width * Globals::G_DEBUGGING_FRAME_SCALING_FACTOR),
+                             static_cast<int32_t>(Globals::G_ROI_BOUNDING_BOX_SIZE.height * Globals::G_DEBUGGING_FRAME_SCALING_FACTOR))
+    {
+    }
+
+    void DebugVisualiser::Show(const LaneDetectionInformation& p_laneDetectionInformation)
+    {
+        // The ROI and Canny frames are at the lane detector scale so are resized, while the hough lines are drawn at the
+        // debugging frame size
+        cv::resize(p_laneDetectionInformation.m_roiFrame, m_roiFrame, m_debuggingFrameSize, 0, 0, cv::INTER_AREA);
+        cv::resize(p_laneDetectionInformation.m_cannyFrame, m_cannyFrame, m_debuggingFrameSize, 0, 0, cv::INTER_AREA);
+
+        DrawHoughLines(p_laneDetectionInformation);
+
+        cv::imshow("roiFrame", m_roiFrame);
+        cv::imshow("cannyFrame", m_cannyFrame);
+        cv::imshow("houghLinesFrame", m_houghLinesFrame);
+    }
+
+    void DebugVisualiser::Close()
+    {
+        cv::destroyWindow("roiFrame");
+        cv::destroyWindow("cannyFrame");
+        cv::destroyWindow("houghLinesFrame");
+    }
+
+    void DebugVisualiser::DrawHoughLines(const LaneDetectionInformation& p_laneDetectionInformation)
+    {
+        m_houghLinesFrame.create(m_debuggingFrameSize, CV_8UC3);
+        m_houghLinesFrame.setTo(cv::Scalar::all(0));
+
+        // The hough lines are in reference co-ordinates, so are offset to the ROI bounding box and scaled to the debugging frame
+        // size with fractional bits to keep the sub-pixel position of the anti-aliased lines
+        const double SCALE = Globals::G_DEBUGGING_FRAME_SCALING_FACTOR * (1 << Globals::G_DEBUGGING_FRAME_LINE_SHIFT);
+        const int32_t THICKNESS = std::max(static_cast<int32_t>(std::lround(Globals::G_HOUGH_LINE_THICKNESS * Globals::G_DEBUGGING_FRAME_SCALING_FACTOR)), 1);
+
+        const auto TO_DEBUGGING_FRAME = [&SCALE](const int32_t& p_x, const int32_t& p_y) {
+            return cv::Point(static_cast<int32_t>(std::lround((p_x - Globals::G_ROI_BOUNDING_BOX_ORIGIN.x) * SCALE)),
+                             static_cast<int32_t>(std::lround((p_y - Globals::G_ROI_BOUNDING_BOX_ORIGIN.y) * SCALE)));
+        };
+
+        const std::vector<cv::Vec4i>& HOUGH_LINES = p_laneDetectionInformation.m_houghLines;
+        const std::vector<Globals::HoughLineTypes>& LINE_TYPES = p_laneDetectionInformation.m_houghLineTypes;
+
+        for (std::size_t i = 0; i < HOUGH_LINES.size(); i++)
+        {
+            const cv::Point POINT_ONE = TO_DEBUGGING_FRAME(HOUGH_LINES[i][Globals::G_VEC4_X1_INDEX], HOUGH_LINES[i][Globals::G_VEC4_Y1_INDEX]);
+            const cv::Point POINT_TWO = TO_DEBUGGING_FRAME(HOUGH_LINES[i][Globals::G_VEC4_X2_INDEX], HOUGH_LINES[i][Globals::G_VEC4_Y2_INDEX]);
+
+            cv::line(m_houghLinesFrame, POINT_ONE, POINT_TWO, Globals::G_HOUGH_LINE_TYPE_COLOURS.at(static_cast<std::size_t>(LINE_TYPES[i])), THICKNESS, cv::LINE_AA, Globals::G_DEBUGGING_FRAME_LINE_SHIFT);
+        }
+    }
+}
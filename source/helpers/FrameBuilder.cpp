@@ -3,12 +3,14 @@
 #include <cmath>
 #include <cstdint>
 #include <format>
+#include <string>
 
 #include <opencv2/core.hpp>
 #include <opencv2/core/mat.hpp>
 #include <opencv2/core/types.hpp>
 #include <opencv2/imgproc.hpp>
 
+#include "helpers/FrameGeometry.hpp"
 #include "helpers/Globals.hpp"
 #include "helpers/Information.hpp"
 
@@ -25,9 +27,9 @@ namespace LaneAndObjectDetection
     {
         AddObjectDetectorInformation(p_frame, p_objectDetectionInformation, p_videoManagerInformation.m_debugMode);
 
-        AddLaneDetectorInformation(p_frame, p_laneDetectionInformation, p_videoManagerInformation.m_debugMode);
+        AddLaneDetectorInformation(p_frame, p_laneDetectionInformation, p_videoManagerInformation.m_frameGeometry, p_videoManagerInformation.m_debugMode);
 
-        AddPerformanceInformation(p_frame, p_performanceInformation, p_videoManagerInformation.m_debugMode);
+        AddPerformanceInformation(p_frame, p_performanceInformation, p_videoManagerInformation.m_frameGeometry, p_videoManagerInformation.m_debugMode);
 
         AddVideoManagerInformation(p_frame, p_videoManagerInformation);
     }
@@ -41,6 +43,8 @@ namespace LaneAndObjectDetection
 
         for (const ObjectDetectionInformation::DetectedObjectInformation& objectInformation : p_objectDetectionInformation.m_objectInformation)
         {
+            const std::string OBJECT_LABEL = std::format("{} ({} %)", Globals::G_OBJECT_DETECTOR_OBJECT_NAMES.at(objectInformation.m_classId), static_cast<uint32_t>(objectInformation.m_confidence * Globals::G_CONVERT_DECIMAL_TO_PERCENTAGE));
+
             // Draw the bounding box
             cv::rectangle(p_frame,
                           objectInformation.m_boundingBox,
@@ -52,7 +56,7 @@ namespace LaneAndObjectDetection
             cv::rectangle(p_frame,
                           cv::Rect(objectInformation.m_boundingBox.x,
                                    objectInformation.m_boundingBox.y - Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_HEADER_HEIGHT,
-                                   std::max(objectInformation.m_boundingBox.width, static_cast<int32_t>(objectInformation.m_objectName.size() * Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_CHARACTER_WIDTH)),
+                                   std::max(objectInformation.m_boundingBox.width, static_cast<int32_t>(OBJECT_LABEL.size() * Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_CHARACTER_WIDTH)),
                                    Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_HEADER_HEIGHT),
                           objectInformation.m_boundingBoxColour,
                           cv::FILLED,
@@ -60,7 +64,7 @@ namespace LaneAndObjectDetection
 
             // Draw the bounding box header text
             cv::putText(p_frame,
-                        objectInformation.m_objectName,
+                        OBJECT_LABEL,
                         cv::Point(objectInformation.m_boundingBox.x, objectInformation.m_boundingBox.y - Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_TEXT_HEIGHT_OFFSET),
                         Globals::G_FONT_DEFAULT_FACE,
                         Globals::G_OBJECT_DETECTOR_BOUNDING_BOX_FONT_SCALE,
@@ -70,13 +74,13 @@ namespace LaneAndObjectDetection
         }
     }
 
-    void FrameBuilder::AddLaneDetectorInformation(cv::Mat& p_frame, const LaneDetectionInformation& p_laneDetectionInformation, const bool& p_debugMode)
+    void FrameBuilder::AddLaneDetectorInformation(cv::Mat& p_frame, const LaneDetectionInformation& p_laneDetectionInformation, const FrameGeometry& p_frameGeometry, const bool& p_debugMode)
     {
         // Add driving state
-        AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_DRIVING_STATE, p_laneDetectionInformation.m_drivingStateTitle, Globals::G_UI_H1_FONT_SCALE);
+        AddBackgroundRectAndCentredText(p_frame, p_frameGeometry.m_uiRectDrivingState, p_laneDetectionInformation.m_drivingStateTitle, Globals::G_UI_H1_FONT_SCALE);
 
         // Add turning state
-        AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_DRIVING_STATE_SUBTITLE, p_laneDetectionInformation.m_drivingStateSubTitle, Globals::G_UI_H2_FONT_SCALE);
+        AddBackgroundRectAndCentredText(p_frame, p_frameGeometry.m_uiRectDrivingStateSubtitle, p_laneDetectionInformation.m_drivingStateSubTitle, Globals::G_UI_H2_FONT_SCALE);
 
         if (!p_debugMode)
         {
@@ -84,12 +88,12 @@ namespace LaneAndObjectDetection
         }
 
         // Draw the green translucent lane overlay to signify the area of the road which is considered the 'current lane'
-        cv::Mat blankFrame = cv::Mat::zeros(Globals::G_VIDEO_INPUT_HEIGHT, Globals::G_VIDEO_INPUT_WIDTH, p_frame.type());
+        cv::Mat blankFrame = cv::Mat::zeros(p_frame.size(), p_frame.type());
         cv::fillConvexPoly(blankFrame, p_laneDetectionInformation.m_laneOverlayCorners, Globals::G_LANE_OVERLAY_COLOUR, cv::LINE_AA);
         cv::add(p_frame, blankFrame, p_frame);
     }
 
-    void FrameBuilder::AddPerformanceInformation(cv::Mat& p_frame, const PerformanceInformation& p_performanceInformation, const bool& p_debugMode)
+    void FrameBuilder::AddPerformanceInformation(cv::Mat& p_frame, const PerformanceInformation& p_performanceInformation, const FrameGeometry& p_frameGeometry, const bool& p_debugMode)
     {
         if (!p_debugMode)
         {
@@ -101,34 +105,40 @@ namespace LaneAndObjectDetection
                                                     std::round(p_performanceInformation.m_currentFramesPerSecond * 100.0) / 100.0,
                                                     std::round(p_performanceInformation.m_averageFramesPerSecond));
 
-        AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_FPS, CURRENT_FPS, Globals::G_UI_H2_FONT_SCALE);
+        AddBackgroundRectAndCentredText(p_frame, p_frameGeometry.m_uiRectFps, CURRENT_FPS, Globals::G_UI_H2_FONT_SCALE);
+
+        const std::string FRAME_READER_STATISTICS = std::format("{} Frames Queued ({} Dropped)",
+                                                                p_performanceInformation.m_frameReaderQueueDepth,
+                                                                p_performanceInformation.m_frameReaderDroppedFrames);
+
+        AddBackgroundRectAndCentredText(p_frame, p_frameGeometry.m_uiRectFrameReader, FRAME_READER_STATISTICS, Globals::G_UI_H2_FONT_SCALE);
     }
 
     void FrameBuilder::AddVideoManagerInformation(cv::Mat& p_frame, const VideoManagerInformation& p_videoManagerInformation)
     {
         // UTC timestamp E.g. Thursday 01 January 1970 10:11:03
         const std::string TIMESTAMP = std::format("{:%A %d %B %Y} ", std::chrono::system_clock::now()) + std::format("{:%H:%M:%S}", std::chrono::system_clock::now()).substr(0, 8);
-        AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_TIMESTAMP, TIMESTAMP, Globals::G_UI_H2_FONT_SCALE);
+        AddBackgroundRectAndCentredText(p_frame, p_videoManagerInformation.m_frameGeometry.m_uiRectTimestamp, TIMESTAMP, Globals::G_UI_H2_FONT_SCALE);
 
-        AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_DEBUG_MODE_STATUS, p_videoManagerInformation.m_debugModeText, Globals::G_UI_H2_FONT_SCALE);
+        AddBackgroundRectAndCentredText(p_frame, p_videoManagerInformation.m_frameGeometry.m_uiRectDebugModeStatus, p_videoManagerInformation.m_debugModeText, Globals::G_UI_H2_FONT_SCALE);
 
         if (p_videoManagerInformation.m_saveOutput)
         {
-            AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_RECORDING_STATUS, p_videoManagerInformation.m_saveOutputText, Globals::G_UI_H2_FONT_SCALE);
-            AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_RECORDING_ELAPSED_TIME, p_videoManagerInformation.m_saveOutputElapsedTime, Globals::G_UI_H2_FONT_SCALE);
+            AddBackgroundRectAndCentredText(p_frame, p_videoManagerInformation.m_frameGeometry.m_uiRectRecordingStatus, p_videoManagerInformation.m_saveOutputText, Globals::G_UI_H2_FONT_SCALE);
+            AddBackgroundRectAndCentredText(p_frame, p_videoManagerInformation.m_frameGeometry.m_uiRectRecordingElapsedTime, p_videoManagerInformation.m_saveOutputElapsedTime, Globals::G_UI_H2_FONT_SCALE);
 
             // Add flashing recording dot and time spent recording
             const uint32_t SECONDS_SINCE_EPOCH = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
             if (static_cast<bool>(SECONDS_SINCE_EPOCH % 2))
             {
-                cv::circle(p_frame, Globals::G_UI_POINT_RECORDING_DOT, Globals::G_UI_RADIUS_RECORDING_DOT, Globals::G_COLOUR_RED, cv::FILLED, cv::LINE_AA);
+                cv::circle(p_frame, p_videoManagerInformation.m_frameGeometry.m_uiPointRecordingDot, Globals::G_UI_RADIUS_RECORDING_DOT, Globals::G_COLOUR_RED, cv::FILLED, cv::LINE_AA);
             }
         }
 
         else
         {
-            AddBackgroundRectAndCentredText(p_frame, Globals::G_UI_RECT_NOT_RECORDING_STATUS, p_videoManagerInformation.m_saveOutputText, Globals::G_UI_H2_FONT_SCALE);
+            AddBackgroundRectAndCentredText(p_frame, p_videoManagerInformation.m_frameGeometry.m_uiRectNotRecordingStatus, p_videoManagerInformation.m_saveOutputText, Globals::G_UI_H2_FONT_SCALE);
         }
     }
 
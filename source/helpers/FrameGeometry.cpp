@@ -0,0 +1,49 @@
+#include <cmath>
+#include <cstdint>
+
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Globals.hpp"
+
+#include "helpers/FrameGeometry.hpp"
+
+namespace LaneAndObjectDetection
+{
+    FrameGeometry::FrameGeometry() :
+        FrameGeometry(cv::Size(Globals::G_VIDEO_INPUT_WIDTH, Globals::G_VIDEO_INPUT_HEIGHT))
+    {}
+
+    FrameGeometry::FrameGeometry(const cv::Size& p_frameSize) :
+        m_frameSize(p_frameSize),
+        m_scalingFactors(static_cast<double>(p_frameSize.width) / Globals::G_VIDEO_INPUT_WIDTH, static_cast<double>(p_frameSize.height) / Globals::G_VIDEO_INPUT_HEIGHT)
+    {
+        const cv::Point ROI_BOUNDING_BOX_TOP_LEFT = FromReference(Globals::G_ROI_BOUNDING_BOX_ORIGIN);
+        const cv::Point ROI_BOUNDING_BOX_BOTTOM_RIGHT = FromReference(Globals::G_ROI_BOUNDING_BOX_ORIGIN + cv::Point(Globals::G_ROI_BOUNDING_BOX_SIZE.width, Globals::G_ROI_BOUNDING_BOX_SIZE.height));
+        m_roiBoundingBox = cv::Rect(ROI_BOUNDING_BOX_TOP_LEFT, ROI_BOUNDING_BOX_BOTTOM_RIGHT) & cv::Rect(cv::Point(0, 0), m_frameSize);
+
+        // The UI is a fixed size in pixels so is moved with the bottom and right edges of the frame rather than scaled
+        const cv::Point BOTTOM_OFFSET = cv::Point(0, p_frameSize.height - static_cast<int32_t>(Globals::G_VIDEO_INPUT_HEIGHT));
+        const cv::Point BOTTOM_RIGHT_OFFSET = cv::Point(p_frameSize.width - static_cast<int32_t>(Globals::G_VIDEO_INPUT_WIDTH), BOTTOM_OFFSET.y);
+
+        m_uiRectTimestamp = Globals::G_UI_RECT_TIMESTAMP + BOTTOM_OFFSET;
+        m_uiRectFps = Globals::G_UI_RECT_FPS + BOTTOM_OFFSET;
+        m_uiRectFrameReader = Globals::G_UI_RECT_FRAME_READER + BOTTOM_OFFSET;
+        m_uiRectDrivingState = cv::Rect(Globals::G_UI_RECT_DRIVING_STATE.x, Globals::G_UI_RECT_DRIVING_STATE.y + BOTTOM_OFFSET.y, p_frameSize.width, Globals::G_UI_RECT_DRIVING_STATE.height);
+        m_uiRectDrivingStateSubtitle = cv::Rect(Globals::G_UI_RECT_DRIVING_STATE_SUBTITLE.x, Globals::G_UI_RECT_DRIVING_STATE_SUBTITLE.y + BOTTOM_OFFSET.y, p_frameSize.width, Globals::G_UI_RECT_DRIVING_STATE_SUBTITLE.height);
+        m_uiRectDebugModeStatus = Globals::G_UI_RECT_DEBUG_MODE_STATUS + BOTTOM_RIGHT_OFFSET;
+        m_uiRectRecordingStatus = Globals::G_UI_RECT_RECORDING_STATUS + BOTTOM_RIGHT_OFFSET;
+        m_uiRectRecordingElapsedTime = Globals::G_UI_RECT_RECORDING_ELAPSED_TIME + BOTTOM_RIGHT_OFFSET;
+        m_uiPointRecordingDot = Globals::G_UI_POINT_RECORDING_DOT + BOTTOM_RIGHT_OFFSET;
+        m_uiRectNotRecordingStatus = Globals::G_UI_RECT_NOT_RECORDING_STATUS + BOTTOM_RIGHT_OFFSET;
+    }
+
+    cv::Point FrameGeometry::ToReference(const cv::Point& p_point) const
+    {
+        return {static_cast<int32_t>(std::lround(p_point.x / m_scalingFactors.x)), static_cast<int32_t>(std::lround(p_point.y / m_scalingFactors.y))};
+    }
+
+    cv::Point FrameGeometry::FromReference(const cv::Point& p_point) const
+    {
+        return {static_cast<int32_t>(std::lround(p_point.x * m_scalingFactors.x)), static_cast<int32_t>(std::lround(p_point.y * m_scalingFactors.y))};
+    }
+}
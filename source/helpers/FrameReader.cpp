@@ -0,0 +1,233 @@
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <opencv2/videoio.hpp>
+
+#include "helpers/Globals.hpp"
+
+#include "helpers/FrameReader.hpp"
+
+namespace LaneAndObjectDetection
+{
+    FrameReader::FrameReader() :
+        m_frameReaderPolicy(Globals::FrameReaderPolicies::BLOCK),
+        m_readIndex(0),
+        m_queueDepth(0),
+        m_droppedFrames(0),
+        m_endOfStream(false),
+        m_stopping(false)
+    {}
+
+    FrameReader::~FrameReader()
+    {
+        Release();
+    }
+
+    bool FrameReader::Open(const int32_t& p_inputVideoCamera)
+    {
+        Release();
+
+        if (!m_inputVideo.open(p_inputVideoCamera))
+        {
+            return false;
+        }
+
+        InitialiseRingBuffer();
+
+        return true;
+    }
+
+    bool FrameReader::Open(const std::string& p_inputVideoFilePath)
+    {
+        Release();
+
+        if (!m_inputVideo.open(p_inputVideoFilePath))
+        {
+            return false;
+        }
+
+        InitialiseRingBuffer();
+
+        return true;
+    }
+
+    void FrameReader::SetPolicy(const Globals::FrameReaderPolicies& p_frameReaderPolicy)
+    {
+        const std::lock_guard<std::mutex> LOCK(m_mutex);
+        m_frameReaderPolicy = p_frameReaderPolicy;
+        m_frameRead.notify_all();
+    }
+
+    bool FrameReader::Read(cv::Mat& p_frame)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (!m_captureThread.joinable() && !m_endOfStream && !m_stopping)
+        {
+            m_captureThread = std::thread(&FrameReader::CaptureFrames, this);
+        }
+
+        m_frameDecoded.wait(lock, [this] { return m_stopping || m_endOfStream || m_queueDepth > 0; });
+
+        if (m_stopping || m_queueDepth == 0)
+        {
+            return false;
+        }
+
+        cv::swap(p_frame, m_ringBuffer[m_readIndex]);
+
+        m_readIndex = (m_readIndex + 1) % m_ringBuffer.size();
+        m_queueDepth--;
+
+        m_frameRead.notify_all();
+
+        return true;
+    }
+
+    void FrameReader::Release()
+    {
+        // The capture thread is started by `Read()` or `GetFrameSize()` under the lock, possibly on another thread, so the
+        // handle is taken under the lock as well. Once stopping no new capture thread can be started.
+        std::thread captureThread;
+
+        {
+            const std::lock_guard<std::mutex> LOCK(m_mutex);
+            m_stopping = true;
+            captureThread = std::move(m_captureThread);
+        }
+
+        m_frameRead.notify_all();
+        m_frameDecoded.notify_all();
+
+        if (captureThread.joinable())
+        {
+            captureThread.join();
+        }
+
+        m_inputVideo.release();
+    }
+
+    cv::Size FrameReader::GetFrameSize()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // The resolution is only unknown if the capture backend could not report it, in which case wait for the first frame
+        // to be decoded. The frame stays in the ring buffer so it will still be returned by `Read()`.
+        if (m_frameSize.empty())
+        {
+            if (!m_captureThread.joinable() && !m_endOfStream && !m_stopping)
+            {
+                m_captureThread = std::thread(&FrameReader::CaptureFrames, this);
+            }
+
+            m_frameDecoded.wait(lock, [this] { return m_stopping || m_endOfStream || m_queueDepth > 0; });
+
+            if (m_queueDepth > 0)
+            {
+                m_frameSize = m_ringBuffer[m_readIndex].size();
+            }
+        }
+
+        return m_frameSize;
+    }
+
+    uint32_t FrameReader::GetQueueDepth()
+    {
+        const std::lock_guard<std::mutex> LOCK(m_mutex);
+        return m_queueDepth;
+    }
+
+    uint32_t FrameReader::GetDroppedFrames()
+    {
+        const std::lock_guard<std::mutex> LOCK(m_mutex);
+        return m_droppedFrames;
+    }
+
+    void FrameReader::InitialiseRingBuffer()
+    {
+        // The input is processed at its native resolution rather than requesting one, as some capture backends silently ignore
+        // the request. Some capture backends cannot report the resolution until the first frame has been decoded, in which case the buffers
+        // will be allocated by the first decode instead
+        const int32_t FRAME_WIDTH = static_cast<int32_t>(m_inputVideo.get(cv::CAP_PROP_FRAME_WIDTH));
+        const int32_t FRAME_HEIGHT = static_cast<int32_t>(m_inputVideo.get(cv::CAP_PROP_FRAME_HEIGHT));
+
+        m_ringBuffer.resize(Globals::G_FRAME_READER_RING_BUFFER_SIZE);
+
+        for (cv::Mat& frame : m_ringBuffer)
+        {
+            if (FRAME_WIDTH > 0 && FRAME_HEIGHT > 0)
+            {
+                frame.create(FRAME_HEIGHT, FRAME_WIDTH, CV_8UC3);
+            }
+        }
+
+        const std::lock_guard<std::mutex> LOCK(m_mutex);
+        m_frameSize = FRAME_WIDTH > 0 && FRAME_HEIGHT > 0 ? cv::Size(FRAME_WIDTH, FRAME_HEIGHT) : cv::Size();
+        m_readIndex = 0;
+        m_queueDepth = 0;
+        m_droppedFrames = 0;
+        m_endOfStream = false;
+        m_stopping = false;
+    }
+
+    void FrameReader::CaptureFrames()
+    {
+        const uint32_t RING_BUFFER_SIZE = m_ringBuffer.size();
+
+        while (true)
+        {
+            uint32_t writeIndex = 0;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_frameRead.wait(lock, [this, RING_BUFFER_SIZE] { return m_stopping || m_queueDepth < RING_BUFFER_SIZE || m_frameReaderPolicy == Globals::FrameReaderPolicies::DROP_OLDEST; });
+
+                if (m_stopping)
+                {
+                    break;
+                }
+
+                // Only reachable with the DROP_OLDEST policy, the oldest frame is discarded to make room for the newest
+                if (m_queueDepth == RING_BUFFER_SIZE)
+                {
+                    m_readIndex = (m_readIndex + 1) % RING_BUFFER_SIZE;
+                    m_queueDepth--;
+                    m_droppedFrames++;
+                }
+
+                writeIndex = (m_readIndex + m_queueDepth) % RING_BUFFER_SIZE;
+            }
+
+            // Decode outside of the lock so that frames already in the ring buffer can be read in the meantime. The slot being
+            // written to is not visible to `Read()` until the queue depth has been incremented.
+            const bool FRAME_DECODED = m_inputVideo.read(m_ringBuffer[writeIndex]);
+
+            {
+                const std::lock_guard<std::mutex> LOCK(m_mutex);
+
+                if (!FRAME_DECODED)
+                {
+                    m_endOfStream = true;
+                }
+
+                else
+                {
+                    m_queueDepth++;
+                }
+            }
+
+            m_frameDecoded.notify_all();
+
+            if (!FRAME_DECODED)
+            {
+                break;
+            }
+        }
+    }
+}
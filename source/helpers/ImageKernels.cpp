@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "helpers/Globals.hpp"
+
+#include "helpers/ImageKernels.hpp"
+
+namespace LaneAndObjectDetection
+{
+    void ImageKernels::ComputeTrapezoidRowSpans(const std::array<cv::Point, Globals::G_NUMBER_OF_POINTS>& p_trapezoidPoints, const cv::Rect& p_region, std::vector<cv::Range>& p_rowSpans)
+    {
+        const cv::Point TOP_LEFT = p_trapezoidPoints[Globals::G_ROI_TOP_LEFT_INDEX];
+        const cv::Point TOP_RIGHT = p_trapezoidPoints[Globals::G_ROI_TOP_RIGHT_INDEX];
+        const cv::Point BOTTOM_RIGHT = p_trapezoidPoints[Globals::G_ROI_BOTTOM_RIGHT_INDEX];
+        const cv::Point BOTTOM_LEFT = p_trapezoidPoints[Globals::G_ROI_BOTTOM_LEFT_INDEX];
+        const double HEIGHT = BOTTOM_LEFT.y - TOP_LEFT.y;
+
+        p_rowSpans.assign(p_region.height, cv::Range(0, 0));
+
+        for (int32_t row = 0; row < p_region.height; row++)
+        {
+            const int32_t Y = p_region.y + row;
+
+            if (Y < TOP_LEFT.y || Y > BOTTOM_LEFT.y)
+            {
+                continue;
+            }
+
+            // Linearly interpolate along the left and right edges, only including pixels whose centres are within the edges
+            const double PROPORTION = HEIGHT == 0 ? 0 : (Y - TOP_LEFT.y) / HEIGHT;
+            const double LEFT_X = TOP_LEFT.x + (PROPORTION * (BOTTOM_LEFT.x - TOP_LEFT.x));
+            const double RIGHT_X = TOP_RIGHT.x + (PROPORTION * (BOTTOM_RIGHT.x - TOP_RIGHT.x));
+
+            const int32_t START = std::clamp(static_cast<int32_t>(std::ceil(LEFT_X)) - p_region.x, 0, p_region.width);
+            const int32_t END = std::clamp(static_cast<int32_t>(std::floor(RIGHT_X)) + 1 - p_region.x, START, p_region.width);
+
+            p_rowSpans[row] = cv::Range(START, END);
+        }
+    }
+
+    void ImageKernels::ConvertMaskedBgrToGrey(const cv::Mat& p_bgrFrame, const std::vector<cv::Range>& p_rowSpans, cv::Mat& p_greyFrame)
+    {
+        p_greyFrame.create(p_bgrFrame.size(), CV_8UC1);
+
+        for (int32_t row = 0; row < p_bgrFrame.rows; row++)
+        {
+            const uint8_t* BGR_ROW = p_bgrFrame.ptr<uint8_t>(row);
+            uint8_t* greyRow = p_greyFrame.ptr<uint8_t>(row);
+            const cv::Range& SPAN = p_rowSpans[row];
+
+            std::fill(greyRow, greyRow + SPAN.start, 0);
+            ConvertBgrToGrey(BGR_ROW + (SPAN.start * 3), greyRow + SPAN.start, SPAN.size());
+            std::fill(greyRow + SPAN.end, greyRow + p_greyFrame.cols, 0);
+        }
+    }
+
+    void ImageKernels::ConvertBgrToGrey(const uint8_t* p_bgrPixels, uint8_t* p_greyPixels, const int32_t& p_numberOfPixels)
+    {
+        int32_t index = 0;
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int32_t NUMBER_OF_LANES = cv::VTraits<cv::v_uint8>::vlanes();
+        const cv::v_uint32 BLUE_WEIGHT = cv::vx_setall_u32(Globals::G_GREY_BLUE_WEIGHT);
+        const cv::v_uint32 GREEN_WEIGHT = cv::vx_setall_u32(Globals::G_GREY_GREEN_WEIGHT);
+        const cv::v_uint32 RED_WEIGHT = cv::vx_setall_u32(Globals::G_GREY_RED_WEIGHT);
+
+        // The weighted sum does not fit in 16 bits so is calculated in 32 bits, then rounded and shifted back down
+        const auto WEIGHTED_SUM = [&](const cv::v_uint16& p_blue, const cv::v_uint16& p_green, const cv::v_uint16& p_red) {
+            cv::v_uint32 blueLow;
+            cv::v_uint32 blueHigh;
+            cv::v_uint32 greenLow;
+            cv::v_uint32 greenHigh;
+            cv::v_uint32 redLow;
+            cv::v_uint32 redHigh;
+            cv::v_expand(p_blue, blueLow, blueHigh);
+            cv::v_expand(p_green, greenLow, greenHigh);
+            cv::v_expand(p_red, redLow, redHigh);
+
+            const cv::v_uint32 LOW = cv::v_add(cv::v_add(cv::v_mul(blueLow, BLUE_WEIGHT), cv::v_mul(greenLow, GREEN_WEIGHT)), cv::v_mul(redLow, RED_WEIGHT));
+            const cv::v_uint32 HIGH = cv::v_add(cv::v_add(cv::v_mul(blueHigh, BLUE_WEIGHT), cv::v_mul(greenHigh, GREEN_WEIGHT)), cv::v_mul(redHigh, RED_WEIGHT));
+
+            return cv::v_rshr_pack<Globals::G_GREY_WEIGHT_SHIFT>(LOW, HIGH);
+        };
+
+        for (; index <= p_numberOfPixels - NUMBER_OF_LANES; index += NUMBER_OF_LANES)
+        {
+            cv::v_uint8 blue;
+            cv::v_uint8 green;
+            cv::v_uint8 red;
+            cv::v_load_deinterleave(p_bgrPixels + (index * 3), blue, green, red);
+
+            cv::v_uint16 blueLow;
+            cv::v_uint16 blueHigh;
+            cv::v_uint16 greenLow;
+            cv::v_uint16 greenHigh;
+            cv::v_uint16 redLow;
+            cv::v_uint16 redHigh;
+            cv::v_expand(blue, blueLow, blueHigh);
+            cv::v_expand(green, greenLow, greenHigh);
+            cv::v_expand(red, redLow, redHigh);
+
+            cv::v_store(p_greyPixels + index, cv::v_pack(WEIGHTED_SUM(blueLow, greenLow, redLow), WEIGHTED_SUM(blueHigh, greenHigh, redHigh)));
+        }
+#endif
+
+        // Scalar tail (or every pixel when SIMD is not available)
+        const uint32_t ROUNDING = 1U << (Globals::G_GREY_WEIGHT_SHIFT - 1);
+
+        for (; index < p_numberOfPixels; index++)
+        {
+            const uint8_t* PIXEL = p_bgrPixels + (index * 3);
+
+            p_greyPixels[index] = static_cast<uint8_t>(((PIXEL[0] * Globals::G_GREY_BLUE_WEIGHT) + (PIXEL[1] * Globals::G_GREY_GREEN_WEIGHT) + (PIXEL[2] * Globals::G_GREY_RED_WEIGHT) + ROUNDING) >> Globals::G_GREY_WEIGHT_SHIFT);
+        }
+    }
+
+    void ImageKernels::ConvertBgrToScaledRgbPlanes(const uint8_t* p_bgrPixels, float* p_redPlane, float* p_greenPlane, float* p_bluePlane, const int32_t& p_numberOfPixels, const float& p_scale)
+    {
+        int32_t index = 0;
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int32_t NUMBER_OF_LANES = cv::VTraits<cv::v_uint8>::vlanes();
+        const int32_t NUMBER_OF_FLOAT_LANES = cv::VTraits<cv::v_float32>::vlanes();
+        const cv::v_float32 SCALE = cv::vx_setall_f32(p_scale);
+
+        // Each channel is widened from 8 to 32 bits in two steps, giving four float vectors per vector of pixels
+        const auto STORE_SCALED = [&](const cv::v_uint8& p_channel, float* p_plane) {
+            cv::v_uint16 low;
+            cv::v_uint16 high;
+            cv::v_expand(p_channel, low, high);
+
+            cv::v_uint32 lowLow;
+            cv::v_uint32 lowHigh;
+            cv::v_uint32 highLow;
+            cv::v_uint32 highHigh;
+            cv::v_expand(low, lowLow, lowHigh);
+            cv::v_expand(high, highLow, highHigh);
+
+            cv::v_store(p_plane, cv::v_mul(cv::v_cvt_f32(cv::v_reinterpret_as_s32(lowLow)), SCALE));
+            cv::v_store(p_plane + NUMBER_OF_FLOAT_LANES, cv::v_mul(cv::v_cvt_f32(cv::v_reinterpret_as_s32(lowHigh)), SCALE));
+            cv::v_store(p_plane + (2 * NUMBER_OF_FLOAT_LANES), cv::v_mul(cv::v_cvt_f32(cv::v_reinterpret_as_s32(highLow)), SCALE));
+            cv::v_store(p_plane + (3 * NUMBER_OF_FLOAT_LANES), cv::v_mul(cv::v_cvt_f32(cv::v_reinterpret_as_s32(highHigh)), SCALE));
+        };
+
+        for (; index <= p_numberOfPixels - NUMBER_OF_LANES; index += NUMBER_OF_LANES)
+        {
+            cv::v_uint8 blue;
+            cv::v_uint8 green;
+            cv::v_uint8 red;
+            cv::v_load_deinterleave(p_bgrPixels + (index * 3), blue, green, red);
+
+            STORE_SCALED(red, p_redPlane + index);
+            STORE_SCALED(green, p_greenPlane + index);
+            STORE_SCALED(blue, p_bluePlane + index);
+        }
+#endif
+
+        // Scalar tail (or every pixel when SIMD is not available)
+        for (; index < p_numberOfPixels; index++)
+        {
+            const uint8_t* PIXEL = p_bgrPixels + (index * 3);
+
+            p_bluePlane[index] = PIXEL[0] * p_scale;
+            p_greenPlane[index] = PIXEL[1] * p_scale;
+            p_redPlane[index] = PIXEL[2] * p_scale;
+        }
+    }
+
+    void ImageKernels::RunStripedCanny(const cv::Mat& p_greyFrame,
+                                       cv::Mat& p_cannyFrame,
+                                       const double& p_lowerThreshold,
+                                       const double& p_upperThreshold,
+                                       const int32_t& p_numberOfStripes,
+                                       std::vector<cv::Mat>& p_stripeBuffers)
+    {
+        p_cannyFrame.create(p_greyFrame.size(), CV_8UC1);
+
+        const int32_t NUMBER_OF_STRIPES = std::clamp(p_numberOfStripes, 1, std::max(1, p_greyFrame.rows / Globals::G_CANNY_STRIPE_MINIMUM_HEIGHT));
+        const int32_t STRIPE_HEIGHT = (p_greyFrame.rows + NUMBER_OF_STRIPES - 1) / NUMBER_OF_STRIPES;
+
+        if (p_stripeBuffers.size() < static_cast<std::size_t>(NUMBER_OF_STRIPES))
+        {
+            p_stripeBuffers.resize(NUMBER_OF_STRIPES);
+        }
+
+        // cv::Canny called within a parallel region runs on the calling worker thread only, so each stripe runs on one thread
+        cv::parallel_for_(cv::Range(0, NUMBER_OF_STRIPES), [&](const cv::Range& p_stripes) {
+            for (int32_t stripe = p_stripes.start; stripe < p_stripes.end; stripe++)
+            {
+                const int32_t START_ROW = std::min(stripe * STRIPE_HEIGHT, p_greyFrame.rows);
+                const int32_t END_ROW = std::min(START_ROW + STRIPE_HEIGHT, p_greyFrame.rows);
+                const int32_t HALO_START_ROW = std::max(START_ROW - Globals::G_CANNY_STRIPE_HALO_ROWS, 0);
+                const int32_t HALO_END_ROW = std::min(END_ROW + Globals::G_CANNY_STRIPE_HALO_ROWS, p_greyFrame.rows);
+
+                if (START_ROW == END_ROW)
+                {
+                    continue;
+                }
+
+                cv::Canny(p_greyFrame.rowRange(HALO_START_ROW, HALO_END_ROW), p_stripeBuffers[stripe], p_lowerThreshold, p_upperThreshold);
+
+                cv::Mat cannyStripe = p_cannyFrame.rowRange(START_ROW, END_ROW);
+                p_stripeBuffers[stripe].rowRange(START_ROW - HALO_START_ROW, END_ROW - HALO_START_ROW).copyTo(cannyStripe);
+            }
+        });
+    }
+}
@@ -0,0 +1,135 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "helpers/MemoryMappedFile.hpp"
+
+namespace LaneAndObjectDetection
+{
+    MemoryMappedFile::MemoryMappedFile() :
+        m_data(nullptr),
+        m_size(0)
+#ifdef _WIN32
+        ,
+        m_mappingHandle(nullptr)
+#endif
+    {}
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+
+    bool MemoryMappedFile::Open(const std::string& p_filePath)
+    {
+        Close();
+
+#ifdef _WIN32
+        const HANDLE FILE_HANDLE = CreateFileA(p_filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (FILE_HANDLE == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+
+        if (GetFileSizeEx(FILE_HANDLE, &fileSize) == 0 || fileSize.QuadPart == 0)
+        {
+            CloseHandle(FILE_HANDLE);
+            return false;
+        }
+
+        // The mapping keeps the file open so its handle is no longer needed
+        m_mappingHandle = CreateFileMappingA(FILE_HANDLE, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(FILE_HANDLE);
+
+        if (m_mappingHandle == nullptr)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const char*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+        if (m_data == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        const int32_t FILE_DESCRIPTOR = open(p_filePath.c_str(), O_RDONLY);
+
+        if (FILE_DESCRIPTOR < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStatus {};
+
+        if (fstat(FILE_DESCRIPTOR, &fileStatus) != 0 || fileStatus.st_size == 0)
+        {
+            close(FILE_DESCRIPTOR);
+            return false;
+        }
+
+        // The mapping keeps the file open so its descriptor is no longer needed
+        void* data = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, FILE_DESCRIPTOR, 0);
+        close(FILE_DESCRIPTOR);
+
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const char*>(data);
+        m_size = static_cast<std::size_t>(fileStatus.st_size);
+#endif
+
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+#ifdef _WIN32
+        if (m_data != nullptr)
+        {
+            UnmapViewOfFile(m_data);
+        }
+
+        if (m_mappingHandle != nullptr)
+        {
+            CloseHandle(m_mappingHandle);
+            m_mappingHandle = nullptr;
+        }
+#else
+        if (m_data != nullptr)
+        {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    const char* MemoryMappedFile::GetData()
+    {
+        return m_data;
+    }
+
+    std::size_t MemoryMappedFile::GetSize()
+    {
+        return m_size;
+    }
+}
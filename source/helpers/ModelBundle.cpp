@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <string>
+
+#include "helpers/Globals.hpp"
+#include "helpers/MemoryMappedFile.hpp"
+
+#include "helpers/ModelBundle.hpp"
+
+namespace
+{
+    /**
+     * @brief The size of the bundle header, which is the magic, version, padding and the offset and size of both files.
+     */
+    const uint64_t BUNDLE_HEADER_SIZE = LaneAndObjectDetection::Globals::G_MODEL_BUNDLE_MAGIC.size() + (sizeof(uint32_t) * 2) + (sizeof(uint64_t) * 4);
+
+    /**
+     * @brief Rounds `p_offset` up to the next multiple of `Globals::G_MODEL_BUNDLE_ALIGNMENT`.
+     *
+     * @param p_offset The offset to align.
+     * @return `uint64_t` The aligned offset.
+     */
+    uint64_t Align(const uint64_t& p_offset)
+    {
+        const uint64_t ALIGNMENT = LaneAndObjectDetection::Globals::G_MODEL_BUNDLE_ALIGNMENT;
+        return ((p_offset + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+    }
+
+    /**
+     * @brief Reads a value from `p_data` at `p_offset` and advances the offset past it.
+     *
+     * @tparam T The trivially copyable type of the value.
+     * @param p_data The data to read from.
+     * @param p_offset The offset to read from, which is advanced by the size of the value.
+     * @return `T` The value read.
+     */
+    template<typename T>
+    T ReadBinary(const char* p_data, uint64_t& p_offset)
+    {
+        T value {};
+        std::memcpy(&value, p_data + p_offset, sizeof(T));
+        p_offset += sizeof(T);
+        return value;
+    }
+
+    /**
+     * @brief Writes the raw bytes of `p_value` to `p_outputFile`.
+     *
+     * @tparam T The trivially copyable type of the value.
+     * @param p_outputFile The file to write to.
+     * @param p_value The value to write.
+     */
+    template<typename T>
+    void WriteBinary(std::ofstream& p_outputFile, const T& p_value)
+    {
+        p_outputFile.write(reinterpret_cast<const char*>(&p_value), sizeof(T));
+    }
+}
+
+namespace LaneAndObjectDetection
+{
+    ModelBundle::ModelBundle() :
+        m_configurationOffset(0),
+        m_configurationSize(0),
+        m_weightsOffset(0),
+        m_weightsSize(0)
+    {}
+
+    bool ModelBundle::Open(const std::string& p_bundleFilePath)
+    {
+        Close();
+
+        if (!m_bundleFile.Open(p_bundleFilePath) || m_bundleFile.GetSize() < BUNDLE_HEADER_SIZE)
+        {
+            Close();
+            return false;
+        }
+
+        const char* DATA = m_bundleFile.GetData();
+        const uint64_t BUNDLE_SIZE = m_bundleFile.GetSize();
+
+        if (!std::equal(Globals::G_MODEL_BUNDLE_MAGIC.begin(), Globals::G_MODEL_BUNDLE_MAGIC.end(), DATA))
+        {
+            Close();
+            return false;
+        }
+
+        uint64_t offset = Globals::G_MODEL_BUNDLE_MAGIC.size();
+        const uint32_t VERSION = ReadBinary<uint32_t>(DATA, offset);
+        ReadBinary<uint32_t>(DATA, offset);
+        m_configurationOffset = ReadBinary<uint64_t>(DATA, offset);
+        m_configurationSize = ReadBinary<uint64_t>(DATA, offset);
+        m_weightsOffset = ReadBinary<uint64_t>(DATA, offset);
+        m_weightsSize = ReadBinary<uint64_t>(DATA, offset);
+
+        // Sizes are checked against the remaining space rather than summed with the offsets so that they cannot overflow
+        if (VERSION != Globals::G_MODEL_BUNDLE_VERSION ||
+            m_configurationOffset > BUNDLE_SIZE || m_configurationSize > BUNDLE_SIZE - m_configurationOffset ||
+            m_weightsOffset > BUNDLE_SIZE || m_weightsSize > BUNDLE_SIZE - m_weightsOffset)
+        {
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void ModelBundle::Close()
+    {
+        m_bundleFile.Close();
+
+        m_configurationOffset = 0;
+        m_configurationSize = 0;
+        m_weightsOffset = 0;
+        m_weightsSize = 0;
+    }
+
+    const char* ModelBundle::GetConfiguration()
+    {
+        return m_bundleFile.GetData() + m_configurationOffset;
+    }
+
+    std::size_t ModelBundle::GetConfigurationSize()
+    {
+        return static_cast<std::size_t>(m_configurationSize);
+    }
+
+    const char* ModelBundle::GetWeights()
+    {
+        return m_bundleFile.GetData() + m_weightsOffset;
+    }
+
+    std::size_t ModelBundle::GetWeightsSize()
+    {
+        return static_cast<std::size_t>(m_weightsSize);
+    }
+
+    bool ModelBundle::Write(const std::string& p_configurationFilePath, const std::string& p_weightsFilePath, const std::string& p_bundleFilePath)
+    {
+        MemoryMappedFile configurationFile;
+        MemoryMappedFile weightsFile;
+
+        if (!configurationFile.Open(p_configurationFilePath) || !weightsFile.Open(p_weightsFilePath))
+        {
+            return false;
+        }
+
+        std::ofstream bundleFile(p_bundleFilePath, std::ios::out | std::ios::trunc | std::ios::binary);
+
+        if (!bundleFile.is_open())
+        {
+            return false;
+        }
+
+        const uint32_t PADDING = 0;
+        const uint64_t CONFIGURATION_OFFSET = Align(BUNDLE_HEADER_SIZE);
+        const uint64_t CONFIGURATION_SIZE = configurationFile.GetSize();
+        const uint64_t WEIGHTS_OFFSET = Align(CONFIGURATION_OFFSET + CONFIGURATION_SIZE);
+        const uint64_t WEIGHTS_SIZE = weightsFile.GetSize();
+
+        bundleFile.write(Globals::G_MODEL_BUNDLE_MAGIC.data(), static_cast<std::streamsize>(Globals::G_MODEL_BUNDLE_MAGIC.size()));
+        WriteBinary(bundleFile, Globals::G_MODEL_BUNDLE_VERSION);
+        WriteBinary(bundleFile, PADDING);
+        WriteBinary(bundleFile, CONFIGURATION_OFFSET);
+        WriteBinary(bundleFile, CONFIGURATION_SIZE);
+        WriteBinary(bundleFile, WEIGHTS_OFFSET);
+        WriteBinary(bundleFile, WEIGHTS_SIZE);
+
+        const std::string ALIGNMENT_PADDING(Globals::G_MODEL_BUNDLE_ALIGNMENT, '\0');
+
+        bundleFile.write(ALIGNMENT_PADDING.data(), static_cast<std::streamsize>(CONFIGURATION_OFFSET - BUNDLE_HEADER_SIZE));
+        bundleFile.write(configurationFile.GetData(), static_cast<std::streamsize>(CONFIGURATION_SIZE));
+        bundleFile.write(ALIGNMENT_PADDING.data(), static_cast<std::streamsize>(WEIGHTS_OFFSET - CONFIGURATION_OFFSET - CONFIGURATION_SIZE));
+        bundleFile.write(weightsFile.GetData(), static_cast<std::streamsize>(WEIGHTS_SIZE));
+
+        // Closed before checking so that an error flushing the end of the bundle is not reported as success
+        bundleFile.close();
+
+        return !bundleFile.fail();
+    }
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <string>
@@ -10,7 +11,7 @@
 namespace LaneAndObjectDetection
 {
     Performance::Performance() :
-        m_performanceInformation({.m_averageFramesPerSecond = 0, .m_currentFramesPerSecond = 0})
+        m_performanceInformation({.m_averageFramesPerSecond = 0, .m_currentFramesPerSecond = 0, .m_frameReaderQueueDepth = 0, .m_frameReaderDroppedFrames = 0})
     {}
 
     void Performance::StartTimer()
@@ -20,15 +21,30 @@ namespace LaneAndObjectDetection
 
     void Performance::EndTimer()
     {
-        const uint32_t FRAME_TIME = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - m_startTime).count();
+        EndTimer(1);
+    }
+
+    void Performance::EndTimer(const uint32_t& p_numberOfFrames)
+    {
+        const uint32_t ELAPSED_TIME = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - m_startTime).count();
+        const uint32_t FRAME_TIME = std::max(ELAPSED_TIME / std::max(p_numberOfFrames, 1U), 1U);
 
-        m_frameTimes.push_back(FRAME_TIME);
+        for (uint32_t i = 0; i < p_numberOfFrames; i++)
+        {
+            m_frameTimes.push_back(FRAME_TIME);
 
-        m_performanceInformation.m_currentFramesPerSecond = Globals::G_MICROSECONDS_IN_SECOND / FRAME_TIME;
+            m_performanceInformation.m_currentFramesPerSecond = Globals::G_MICROSECONDS_IN_SECOND / FRAME_TIME;
 
-        // Calculate the average FPS as a running average
-        const double FRAME_COUNT = static_cast<double>(m_frameTimes.size());
-        m_performanceInformation.m_averageFramesPerSecond = ((m_performanceInformation.m_averageFramesPerSecond * (FRAME_COUNT - 1)) + m_performanceInformation.m_currentFramesPerSecond) / FRAME_COUNT;
+            // Calculate the average FPS as a running average
+            const double FRAME_COUNT = static_cast<double>(m_frameTimes.size());
+            m_performanceInformation.m_averageFramesPerSecond = ((m_performanceInformation.m_averageFramesPerSecond * (FRAME_COUNT - 1)) + m_performanceInformation.m_currentFramesPerSecond) / FRAME_COUNT;
+        }
+    }
+
+    void Performance::UpdateFrameReaderStatistics(const uint32_t& p_queueDepth, const uint32_t& p_droppedFrames)
+    {
+        m_performanceInformation.m_frameReaderQueueDepth = p_queueDepth;
+        m_performanceInformation.m_frameReaderDroppedFrames = p_droppedFrames;
     }
 
     PerformanceInformation Performance::GetInformation()
@@ -41,6 +57,11 @@ namespace LaneAndObjectDetection
         return m_frameTimes;
     }
 
+    uint32_t Performance::GetLastFrameTime()
+    {
+        return m_frameTimes.empty() ? 0 : m_frameTimes.back();
+    }
+
     std::string Performance::GetTimeUnit()
     {
         return Globals::G_TIME_UNIT;
@@ -54,6 +75,6 @@ namespace LaneAndObjectDetection
     void Performance::ClearPerformanceInformation()
     {
         m_frameTimes.clear();
-        m_performanceInformation = {.m_averageFramesPerSecond = 0, .m_currentFramesPerSecond = 0};
+        m_performanceInformation = {.m_averageFramesPerSecond = 0, .m_currentFramesPerSecond = 0, .m_frameReaderQueueDepth = 0, .m_frameReaderDroppedFrames = 0};
     }
 }
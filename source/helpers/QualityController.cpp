@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "helpers/Globals.hpp"
+
+#include "helpers/QualityController.hpp"
+
+namespace LaneAndObjectDetection
+{
+    QualityController::QualityController() :
+        m_targetFrameTime(0),
+        m_averageFrameTime(0),
+        m_level(0),
+        m_requestedLevel(0),
+        m_framesOverBudget(0),
+        m_framesUnderBudget(0),
+        m_framesSinceLevelChange(0),
+        m_upgradeBackoffLevel(0),
+        m_upgradeBackoffFrames(0)
+    {}
+
+    void QualityController::SetTargetFramesPerSecond(const double& p_targetFramesPerSecond)
+    {
+        m_targetFrameTime = p_targetFramesPerSecond > Globals::G_QUALITY_CONTROLLER_DISABLED ? Globals::G_MICROSECONDS_IN_SECOND / p_targetFramesPerSecond : 0;
+    }
+
+    void QualityController::SetStartingLevel(const Globals::ObjectDetectorTypes& p_objectDetectorTypes, const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+    {
+        uint32_t startingLevel = 0;
+        int32_t smallestBlobSizeDifference = INT32_MAX;
+
+        for (uint32_t level = 0; level < Globals::G_QUALITY_CONTROLLER_NUMBER_OF_LEVELS; level++)
+        {
+            const int32_t BLOB_SIZE_DIFFERENCE = std::abs(static_cast<int32_t>(Globals::G_QUALITY_CONTROLLER_BLOB_SIZES[level]) - static_cast<int32_t>(p_objectDetectorBlobSizes));
+
+            if (Globals::G_QUALITY_CONTROLLER_OBJECT_DETECTOR_TYPES[level] == p_objectDetectorTypes && BLOB_SIZE_DIFFERENCE < smallestBlobSizeDifference)
+            {
+                startingLevel = level;
+                smallestBlobSizeDifference = BLOB_SIZE_DIFFERENCE;
+            }
+        }
+
+        m_averageFrameTime = 0;
+        m_upgradeBackoffFrames = 0;
+        m_level = startingLevel;
+        m_requestedLevel = startingLevel;
+        m_framesOverBudget = 0;
+        m_framesUnderBudget = 0;
+        m_framesSinceLevelChange = 0;
+    }
+
+    void QualityController::SetLevel(const uint32_t& p_level)
+    {
+        const uint32_t LEVEL = std::min(p_level, Globals::G_QUALITY_CONTROLLER_NUMBER_OF_LEVELS - 1);
+
+        // Stop the quality from oscillating between a level that is just over the budget and the one below it
+        if (LEVEL < m_level)
+        {
+            m_upgradeBackoffLevel = m_level;
+            m_upgradeBackoffFrames = Globals::G_QUALITY_CONTROLLER_UPGRADE_BACKOFF_FRAMES;
+        }
+
+        m_level = LEVEL;
+        m_requestedLevel = LEVEL;
+        m_framesOverBudget = 0;
+        m_framesUnderBudget = 0;
+        m_framesSinceLevelChange = 0;
+    }
+
+    void QualityController::Update(const uint32_t& p_frameTime)
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        m_averageFrameTime = m_averageFrameTime == 0 ? p_frameTime : (Globals::G_QUALITY_CONTROLLER_SMOOTHING * p_frameTime) + ((1 - Globals::G_QUALITY_CONTROLLER_SMOOTHING) * m_averageFrameTime);
+        m_framesSinceLevelChange++;
+        m_upgradeBackoffFrames = m_upgradeBackoffFrames > 0 ? m_upgradeBackoffFrames - 1 : 0;
+
+        // The budget has a wider margin below than above it so that a level which only just fits is kept
+        if (m_averageFrameTime > m_targetFrameTime * (1 + Globals::G_QUALITY_CONTROLLER_DOWNGRADE_MARGIN))
+        {
+            m_framesOverBudget++;
+            m_framesUnderBudget = 0;
+        }
+
+        else if (m_averageFrameTime < m_targetFrameTime * (1 - Globals::G_QUALITY_CONTROLLER_UPGRADE_MARGIN))
+        {
+            m_framesUnderBudget++;
+            m_framesOverBudget = 0;
+        }
+
+        else
+        {
+            m_framesOverBudget = 0;
+            m_framesUnderBudget = 0;
+        }
+
+        // Wait for the average to settle at the current level before acting on it
+        if (m_framesSinceLevelChange < Globals::G_QUALITY_CONTROLLER_COOLDOWN_FRAMES)
+        {
+            return;
+        }
+
+        if (m_framesOverBudget >= Globals::G_QUALITY_CONTROLLER_HOLD_FRAMES && m_level > 0)
+        {
+            m_requestedLevel = m_level - 1;
+        }
+
+        else if (m_framesUnderBudget >= Globals::G_QUALITY_CONTROLLER_HOLD_FRAMES && m_level + 1 < Globals::G_QUALITY_CONTROLLER_NUMBER_OF_LEVELS &&
+                 (m_level + 1 != m_upgradeBackoffLevel || m_upgradeBackoffFrames == 0))
+        {
+            m_requestedLevel = m_level + 1;
+        }
+    }
+
+    bool QualityController::IsEnabled()
+    {
+        return m_targetFrameTime > 0;
+    }
+
+    uint32_t QualityController::GetLevel()
+    {
+        return m_level;
+    }
+
+    uint32_t QualityController::GetRequestedLevel()
+    {
+        return m_requestedLevel;
+    }
+
+    uint32_t QualityController::GetPreloadLevel()
+    {
+        if (m_requestedLevel != m_level || m_averageFrameTime == 0)
+        {
+            return m_requestedLevel;
+        }
+
+        // Preload the level in the direction that the frame time is heading so that it is ready before it is requested
+        if (m_averageFrameTime > m_targetFrameTime)
+        {
+            return m_level > 0 ? m_level - 1 : m_level;
+        }
+
+        return m_level + 1 < Globals::G_QUALITY_CONTROLLER_NUMBER_OF_LEVELS ? m_level + 1 : m_level;
+    }
+}
@@ -0,0 +1,214 @@
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#ifdef _WIN32
+#include <cstdio>
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#include <opencv2/core/types.hpp>
+
+#include "helpers/Globals.hpp"
+#include "helpers/Information.hpp"
+
+#include "helpers/ResultsWriter.hpp"
+
+namespace LaneAndObjectDetection
+{
+    ResultsWriter::ResultsWriter() :
+        m_outputStream(nullptr),
+        m_resultsFormat(Globals::ResultsFormats::JSON_LINES),
+        m_frameNumber(0),
+        m_writingToStandardOutput(false)
+    {}
+
+    bool ResultsWriter::Open(const std::string& p_resultsFilePath, const Globals::ResultsFormats& p_resultsFormat)
+    {
+        Close();
+
+        m_resultsFormat = p_resultsFormat;
+        m_frameNumber = 0;
+        m_writingToStandardOutput = p_resultsFilePath == "-";
+
+        if (m_writingToStandardOutput)
+        {
+            m_outputStream = &std::cout;
+
+#ifdef _WIN32
+            // Standard output is opened in text mode on Windows, which would expand every 0x0A byte of a binary record to CRLF
+            if (m_resultsFormat == Globals::ResultsFormats::BINARY)
+            {
+                std::cout.flush();
+                _setmode(_fileno(stdout), _O_BINARY);
+            }
+#endif
+        }
+
+        else
+        {
+            m_resultsFile.open(p_resultsFilePath, std::ios::out | std::ios::trunc | std::ios::binary);
+
+            if (!m_resultsFile.is_open())
+            {
+                return false;
+            }
+
+            m_outputStream = &m_resultsFile;
+        }
+
+        if (m_resultsFormat == Globals::ResultsFormats::BINARY)
+        {
+            m_record.clear();
+            m_record.append(Globals::G_RESULTS_BINARY_MAGIC.data(), Globals::G_RESULTS_BINARY_MAGIC.size());
+            AppendBinary(Globals::G_RESULTS_BINARY_VERSION);
+            m_outputStream->write(m_record.data(), static_cast<std::streamsize>(m_record.size()));
+        }
+
+        return true;
+    }
+
+    void ResultsWriter::Write(const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation)
+    {
+        if (m_outputStream == nullptr)
+        {
+            return;
+        }
+
+        m_record.clear();
+
+        switch (m_resultsFormat)
+        {
+        case Globals::ResultsFormats::JSON_LINES:
+            BuildJsonLinesRecord(p_objectDetectionInformation, p_laneDetectionInformation);
+            break;
+
+        case Globals::ResultsFormats::BINARY:
+            BuildBinaryRecord(p_objectDetectionInformation, p_laneDetectionInformation);
+            break;
+
+        default:
+            throw Globals::Exceptions::NotImplementedError();
+        }
+
+        m_outputStream->write(m_record.data(), static_cast<std::streamsize>(m_record.size()));
+
+        if (m_writingToStandardOutput)
+        {
+            m_outputStream->flush();
+        }
+
+        m_frameNumber++;
+    }
+
+    void ResultsWriter::Close()
+    {
+        if (m_outputStream != nullptr)
+        {
+            m_outputStream->flush();
+        }
+
+        if (m_resultsFile.is_open())
+        {
+            m_resultsFile.close();
+        }
+
+        m_outputStream = nullptr;
+    }
+
+    bool ResultsWriter::IsOpen()
+    {
+        return m_outputStream != nullptr;
+    }
+
+    void ResultsWriter::BuildJsonLinesRecord(const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation)
+    {
+        std::back_insert_iterator<std::string> output = std::back_inserter(m_record);
+
+        std::format_to(output, "{{\"frame\":{},\"objects\":[", m_frameNumber);
+
+        bool firstObject = true;
+
+        for (const ObjectDetectionInformation::DetectedObjectInformation& objectInformation : p_objectDetectionInformation.m_objectInformation)
+        {
+            // Object names are all plain ASCII words so do not need escaping
+            std::format_to(output,
+                           "{}{{\"classId\":{},\"name\":\"{}\",\"confidence\":{:.4f},\"boundingBox\":[{},{},{},{}]}}",
+                           firstObject ? "" : ",",
+                           objectInformation.m_classId,
+                           Globals::G_OBJECT_DETECTOR_OBJECT_NAMES.at(objectInformation.m_classId),
+                           objectInformation.m_confidence,
+                           objectInformation.m_boundingBox.x,
+                           objectInformation.m_boundingBox.y,
+                           objectInformation.m_boundingBox.width,
+                           objectInformation.m_boundingBox.height);
+
+            firstObject = false;
+        }
+
+        std::format_to(output,
+                       "],\"lane\":{{\"drivingState\":{},\"leftLineType\":{},\"rightLineType\":{},\"overlayCorners\":[",
+                       static_cast<uint32_t>(p_laneDetectionInformation.m_drivingState),
+                       static_cast<uint32_t>(p_laneDetectionInformation.m_leftLineType),
+                       static_cast<uint32_t>(p_laneDetectionInformation.m_rightLineType));
+
+        bool firstCorner = true;
+
+        for (const cv::Point& corner : p_laneDetectionInformation.m_laneOverlayCorners)
+        {
+            std::format_to(output, "{}[{},{}]", firstCorner ? "" : ",", corner.x, corner.y);
+
+            firstCorner = false;
+        }
+
+        m_record.append("]}}\n");
+    }
+
+    void ResultsWriter::BuildBinaryRecord(const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation)
+    {
+        const uint8_t PADDING = 0;
+        const uint32_t NUMBER_OF_OVERLAY_CORNERS = 4;
+
+        AppendBinary(m_frameNumber);
+        AppendBinary(static_cast<uint8_t>(p_laneDetectionInformation.m_drivingState));
+        AppendBinary(static_cast<uint8_t>(p_laneDetectionInformation.m_leftLineType));
+        AppendBinary(static_cast<uint8_t>(p_laneDetectionInformation.m_rightLineType));
+        AppendBinary(PADDING);
+
+        // The overlay corners are only set once the lane detector has run, so always write a fixed number to keep the record
+        // layout fixed
+        for (uint32_t i = 0; i < NUMBER_OF_OVERLAY_CORNERS; i++)
+        {
+            const cv::Point CORNER = i < p_laneDetectionInformation.m_laneOverlayCorners.size() ? p_laneDetectionInformation.m_laneOverlayCorners[i] : cv::Point(0, 0);
+
+            AppendBinary(static_cast<int32_t>(CORNER.x));
+            AppendBinary(static_cast<int32_t>(CORNER.y));
+        }
+
+        AppendBinary(static_cast<uint32_t>(p_objectDetectionInformation.m_objectInformation.size()));
+
+        for (const ObjectDetectionInformation::DetectedObjectInformation& objectInformation : p_objectDetectionInformation.m_objectInformation)
+        {
+            AppendBinary(objectInformation.m_classId);
+            AppendBinary(objectInformation.m_confidence);
+            AppendBinary(static_cast<int32_t>(objectInformation.m_boundingBox.x));
+            AppendBinary(static_cast<int32_t>(objectInformation.m_boundingBox.y));
+            AppendBinary(static_cast<int32_t>(objectInformation.m_boundingBox.width));
+            AppendBinary(static_cast<int32_t>(objectInformation.m_boundingBox.height));
+        }
+    }
+
+    template<typename T>
+    void ResultsWriter::AppendBinary(const T& p_value)
+    {
+        const std::size_t CURRENT_SIZE = m_record.size();
+        m_record.resize(CURRENT_SIZE + sizeof(T));
+        std::memcpy(m_record.data() + CURRENT_SIZE, &p_value, sizeof(T));
+    }
+}
@@ -1,27 +1,45 @@
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <format>
 #include <iostream>
+#include <optional>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include <opencv2/core/mat.hpp>
 #include <opencv2/core/types.hpp>
 #include <opencv2/highgui.hpp>
 #include <opencv2/videoio.hpp>
 
 #include "detectors/LaneDetector.hpp"
+#include "detectors/NetworkCache.hpp"
 #include "detectors/ObjectDetector.hpp"
+#include "helpers/BoundedQueue.hpp"
+#include "helpers/DebugVisualiser.hpp"
 #include "helpers/FrameBuilder.hpp"
+#include "helpers/FrameGeometry.hpp"
+#include "helpers/FrameReader.hpp"
 #include "helpers/Globals.hpp"
 #include "helpers/Information.hpp"
 #include "helpers/Performance.hpp"
+#include "helpers/QualityController.hpp"
+#include "helpers/ResultsWriter.hpp"
+#include "helpers/ScopeGuard.hpp"
 
 #include "helpers/VideoManager.hpp"
 
 namespace LaneAndObjectDetection
 {
-    VideoManager::VideoManager()
+    VideoManager::VideoManager() :
+        m_processingMode(Globals::ProcessingModes::SEQUENTIAL),
+        m_resultsFormat(Globals::ResultsFormats::JSON_LINES),
+        m_objectDetectorBatchSize(1),
+        m_headless(false)
     {
         m_videoManagerInformation.m_saveOutputText = Globals::G_UI_TEXT_NOT_RECORDING;
         m_videoManagerInformation.m_debugModeText = Globals::G_UI_TEXT_NOT_DEBUG_MODE;
@@ -33,7 +51,11 @@ namespace LaneAndObjectDetection
                                const std::string& p_yoloFolderPath,
                                const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
                                const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
-                               const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+                               const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes) :
+        m_processingMode(Globals::ProcessingModes::SEQUENTIAL),
+        m_resultsFormat(Globals::ResultsFormats::JSON_LINES),
+        m_objectDetectorBatchSize(1),
+        m_headless(false)
     {
         m_videoManagerInformation.m_saveOutputText = Globals::G_UI_TEXT_NOT_RECORDING;
         m_videoManagerInformation.m_debugModeText = Globals::G_UI_TEXT_NOT_DEBUG_MODE;
@@ -47,7 +69,11 @@ namespace LaneAndObjectDetection
                                const std::string& p_yoloFolderPath,
                                const Globals::ObjectDetectorTypes& p_objectDetectorTypes,
                                const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
-                               const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
+                               const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes) :
+        m_processingMode(Globals::ProcessingModes::SEQUENTIAL),
+        m_resultsFormat(Globals::ResultsFormats::JSON_LINES),
+        m_objectDetectorBatchSize(1),
+        m_headless(false)
     {
         m_videoManagerInformation.m_saveOutputText = Globals::G_UI_TEXT_NOT_RECORDING;
         m_videoManagerInformation.m_debugModeText = Globals::G_UI_TEXT_NOT_DEBUG_MODE;
@@ -57,7 +83,11 @@ namespace LaneAndObjectDetection
         SetProperties(p_inputVideoFilePath, p_yoloFolderPath, p_objectDetectorTypes, p_objectDetectorBackEnds, p_objectDetectorBlobSizes);
     }
 
-    VideoManager::VideoManager(const std::vector<std::string>& p_commandLineArguments) // NOLINT(readability-function-cognitive-complexity)
+    VideoManager::VideoManager(const std::vector<std::string>& p_commandLineArguments) : // NOLINT(readability-function-cognitive-complexity)
+        m_processingMode(Globals::ProcessingModes::SEQUENTIAL),
+        m_resultsFormat(Globals::ResultsFormats::JSON_LINES),
+        m_objectDetectorBatchSize(1),
+        m_headless(false)
     {
         m_videoManagerInformation.m_saveOutputText = Globals::G_UI_TEXT_NOT_RECORDING;
         m_videoManagerInformation.m_debugModeText = Globals::G_UI_TEXT_NOT_DEBUG_MODE;
@@ -133,6 +163,16 @@ namespace LaneAndObjectDetection
                         parsedObjectDetectorBackEnds = Globals::ObjectDetectorBackEnds::CUDA;
                     }
 
+                    else if (p_commandLineArguments.at(index + 1) == "cpu-fp16")
+                    {
+                        parsedObjectDetectorBackEnds = Globals::ObjectDetectorBackEnds::CPU_FP16;
+                    }
+
+                    else if (p_commandLineArguments.at(index + 1) == "cpu-int8")
+                    {
+                        parsedObjectDetectorBackEnds = Globals::ObjectDetectorBackEnds::CPU_INT8;
+                    }
+
                     else
                     {
                         std::cout << Globals::G_CLI_HELP_MESSAGE;
@@ -144,6 +184,159 @@ namespace LaneAndObjectDetection
                 {
                     parsedObjectDetectorBlobSizes = static_cast<Globals::ObjectDetectorBlobSizes>(std::stoi(p_commandLineArguments.at(index + 1)));
                 }
+
+                if (argument == "-n" || argument == "--object-detector-batch-size")
+                {
+                    const int32_t OBJECT_DETECTOR_BATCH_SIZE = std::stoi(p_commandLineArguments.at(index + 1));
+
+                    if (OBJECT_DETECTOR_BATCH_SIZE < 1)
+                    {
+                        std::cout << Globals::G_CLI_HELP_MESSAGE;
+                        std::exit(1);
+                    }
+
+                    m_objectDetectorBatchSize = static_cast<uint32_t>(OBJECT_DETECTOR_BATCH_SIZE);
+                }
+
+                if (argument == "-d" || argument == "--object-detector-interval")
+                {
+                    if (p_commandLineArguments.at(index + 1) == "adaptive")
+                    {
+                        m_objectDetector.SetDetectionInterval(Globals::G_OBJECT_DETECTOR_ADAPTIVE_INTERVAL);
+                    }
+
+                    else
+                    {
+                        const int32_t OBJECT_DETECTOR_INTERVAL = std::stoi(p_commandLineArguments.at(index + 1));
+
+                        if (OBJECT_DETECTOR_INTERVAL <= 0)
+                        {
+                            std::cout << Globals::G_CLI_HELP_MESSAGE;
+                            std::exit(1);
+                        }
+
+                        m_objectDetector.SetDetectionInterval(OBJECT_DETECTOR_INTERVAL);
+                    }
+                }
+
+                if (argument == "-c" || argument == "--horizon-crop")
+                {
+                    m_objectDetector.SetHorizonCrop(true);
+                }
+
+                if (argument == "-t" || argument == "--target-fps")
+                {
+                    const double TARGET_FRAMES_PER_SECOND = std::stod(p_commandLineArguments.at(index + 1));
+
+                    if (TARGET_FRAMES_PER_SECOND <= 0)
+                    {
+                        std::cout << Globals::G_CLI_HELP_MESSAGE;
+                        std::exit(1);
+                    }
+
+                    m_qualityController.SetTargetFramesPerSecond(TARGET_FRAMES_PER_SECOND);
+                }
+
+                if (argument == "-l" || argument == "--lane-detector-scale")
+                {
+                    if (p_commandLineArguments.at(index + 1) == "full")
+                    {
+                        m_laneDetector.SetScale(Globals::LaneDetectorScales::FULL);
+                    }
+
+                    else if (p_commandLineArguments.at(index + 1) == "half")
+                    {
+                        m_laneDetector.SetScale(Globals::LaneDetectorScales::HALF);
+                    }
+
+                    else if (p_commandLineArguments.at(index + 1) == "quarter")
+                    {
+                        m_laneDetector.SetScale(Globals::LaneDetectorScales::QUARTER);
+                    }
+
+                    else
+                    {
+                        std::cout << Globals::G_CLI_HELP_MESSAGE;
+                        std::exit(1);
+                    }
+                }
+
+                if (argument == "-f" || argument == "--frame-reader-policy")
+                {
+                    if (p_commandLineArguments.at(index + 1) == "block")
+                    {
+                        m_frameReader.SetPolicy(Globals::FrameReaderPolicies::BLOCK);
+                    }
+
+                    else if (p_commandLineArguments.at(index + 1) == "drop-oldest")
+                    {
+                        m_frameReader.SetPolicy(Globals::FrameReaderPolicies::DROP_OLDEST);
+                    }
+
+                    else
+                    {
+                        std::cout << Globals::G_CLI_HELP_MESSAGE;
+                        std::exit(1);
+                    }
+                }
+
+                if (argument == "-w" || argument == "--output-video-file-path")
+                {
+                    m_outputVideoFilePath = p_commandLineArguments.at(index + 1);
+                }
+
+                if (argument == "-H" || argument == "--headless")
+                {
+                    m_headless = true;
+                }
+
+                if (argument == "-r" || argument == "--results-file-path")
+                {
+                    m_resultsFilePath = p_commandLineArguments.at(index + 1);
+                }
+
+                if (argument == "-e" || argument == "--results-format")
+                {
+                    if (p_commandLineArguments.at(index + 1) == "json-lines")
+                    {
+                        m_resultsFormat = Globals::ResultsFormats::JSON_LINES;
+                    }
+
+                    else if (p_commandLineArguments.at(index + 1) == "binary")
+                    {
+                        m_resultsFormat = Globals::ResultsFormats::BINARY;
+                    }
+
+                    else
+                    {
+                        std::cout << Globals::G_CLI_HELP_MESSAGE;
+                        std::exit(1);
+                    }
+                }
+
+                if (argument == "-m" || argument == "--processing-mode")
+                {
+                    if (p_commandLineArguments.at(index + 1) == "sequential")
+                    {
+                        m_processingMode = Globals::ProcessingModes::SEQUENTIAL;
+                    }
+
+                    else if (p_commandLineArguments.at(index + 1) == "concurrent")
+                    {
+                        m_processingMode = Globals::ProcessingModes::CONCURRENT;
+                    }
+
+                    else if (p_commandLineArguments.at(index + 1) == "pipelined")
+                    {
+                        m_processingMode = Globals::ProcessingModes::PIPELINED;
+                    }
+
+                    else
+                    {
+                        std::cout << Globals::G_CLI_HELP_MESSAGE;
+                        std::exit(1);
+                    }
+                }
             }
 
             catch (...)
@@ -164,6 +357,35 @@ namespace LaneAndObjectDetection
             std::exit(1);
         }
 
+        if (parsedObjectDetectorTypes != Globals::ObjectDetectorTypes::NONE && parsedObjectDetectorBackEnds == Globals::ObjectDetectorBackEnds::CPU_INT8 &&
+            !NetworkCache::HasCalibrationFrames(parsedYoloFolderPath))
+        {
+            std::cout << std::format("\nERROR: No calibration frames for the INT8 backend were found in '{}'!\n", parsedYoloFolderPath + Globals::G_OBJECT_DETECTOR_CALIBRATION_FOLDER_NAME);
+            std::exit(1);
+        }
+
+        // Batching is only supported in sequential mode
+        if (m_objectDetectorBatchSize > 1 && m_processingMode != Globals::ProcessingModes::SEQUENTIAL)
+        {
+            std::cout << Globals::G_CLI_HELP_MESSAGE;
+            std::exit(1);
+        }
+
+        // The object detector interval and horizon crop are only used one frame at a time, so would otherwise be ignored
+        // when batching
+        if ((m_objectDetector.GetDetectionInterval() != 1 || m_objectDetector.IsHorizonCropEnabled()) && m_objectDetectorBatchSize > 1)
+        {
+            std::cout << Globals::G_CLI_HELP_MESSAGE;
+            std::exit(1);
+        }
+
+        // The quality controller only runs between frames in sequential and concurrent modes without batching
+        if (m_qualityController.IsEnabled() && (m_objectDetectorBatchSize > 1 || m_processingMode == Globals::ProcessingModes::PIPELINED))
+        {
+            std::cout << Globals::G_CLI_HELP_MESSAGE;
+            std::exit(1);
+        }
+
         SetProperties(parsedInputVideoFilePath, parsedYoloFolderPath, parsedObjectDetectorTypes, parsedObjectDetectorBackEnds, parsedObjectDetectorBlobSizes);
     }
 
@@ -178,16 +400,13 @@ namespace LaneAndObjectDetection
                                      const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
                                      const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
     {
-        m_inputVideo.open(p_inputVideoCamera);
-
-        if (!m_inputVideo.isOpened())
+        if (!m_frameReader.Open(p_inputVideoCamera))
         {
             std::cout << "\nERROR: Input video camera '" + std::to_string(p_inputVideoCamera) + "' cannot be found!\n";
             std::exit(1);
         }
 
-        m_inputVideo.set(cv::CAP_PROP_FRAME_WIDTH, Globals::G_VIDEO_INPUT_WIDTH);
-        m_inputVideo.set(cv::CAP_PROP_FRAME_HEIGHT, Globals::G_VIDEO_INPUT_HEIGHT);
+        UpdateFrameGeometry();
 
         if (m_videoManagerInformation.m_saveOutput)
         {
@@ -195,6 +414,7 @@ namespace LaneAndObjectDetection
         }
 
         m_objectDetector.SetProperties(p_yoloFolderPath, p_objectDetectorTypes, p_objectDetectorBackEnds, p_objectDetectorBlobSizes);
+        m_qualityController.SetStartingLevel(p_objectDetectorTypes, p_objectDetectorBlobSizes);
 
         m_performance.ClearPerformanceInformation();
     }
@@ -205,16 +425,13 @@ namespace LaneAndObjectDetection
                                      const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnds,
                                      const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSizes)
     {
-        m_inputVideo.open(p_inputVideoFilePath);
-
-        if (!m_inputVideo.isOpened())
+        if (!m_frameReader.Open(p_inputVideoFilePath))
         {
             std::cout << "\nERROR: Input video file path '" + p_inputVideoFilePath + "' cannot be found!\n";
             std::exit(1);
         }
 
-        m_inputVideo.set(cv::CAP_PROP_FRAME_WIDTH, Globals::G_VIDEO_INPUT_WIDTH);
-        m_inputVideo.set(cv::CAP_PROP_FRAME_HEIGHT, Globals::G_VIDEO_INPUT_HEIGHT);
+        UpdateFrameGeometry();
 
         if (m_videoManagerInformation.m_saveOutput)
         {
@@ -222,67 +439,486 @@ namespace LaneAndObjectDetection
         }
 
         m_objectDetector.SetProperties(p_yoloFolderPath, p_objectDetectorTypes, p_objectDetectorBackEnds, p_objectDetectorBlobSizes);
+        m_qualityController.SetStartingLevel(p_objectDetectorTypes, p_objectDetectorBlobSizes);
 
         m_performance.ClearPerformanceInformation();
     }
 
+    void VideoManager::SetProcessingMode(const Globals::ProcessingModes& p_processingMode)
+    {
+        m_processingMode = p_processingMode;
+    }
+
+    void VideoManager::SetFrameReaderPolicy(const Globals::FrameReaderPolicies& p_frameReaderPolicy)
+    {
+        m_frameReader.SetPolicy(p_frameReaderPolicy);
+    }
+
+    void VideoManager::SetHeadless(const bool& p_headless)
+    {
+        m_headless = p_headless;
+    }
+
+    void VideoManager::SetOutputVideoFilePath(const std::string& p_outputVideoFilePath)
+    {
+        m_outputVideoFilePath = p_outputVideoFilePath;
+    }
+
+    void VideoManager::SetResultsOutput(const std::string& p_resultsFilePath, const Globals::ResultsFormats& p_resultsFormat)
+    {
+        m_resultsFilePath = p_resultsFilePath;
+        m_resultsFormat = p_resultsFormat;
+    }
+
+    void VideoManager::SetObjectDetectorBatchSize(const uint32_t& p_objectDetectorBatchSize)
+    {
+        m_objectDetectorBatchSize = std::max(p_objectDetectorBatchSize, 1U);
+    }
+
+    void VideoManager::SetObjectDetectorInterval(const uint32_t& p_objectDetectorInterval)
+    {
+        m_objectDetector.SetDetectionInterval(p_objectDetectorInterval);
+    }
+
+    void VideoManager::SetObjectDetectorHorizonCrop(const bool& p_horizonCrop)
+    {
+        m_objectDetector.SetHorizonCrop(p_horizonCrop);
+    }
+
+    void VideoManager::SetTargetFramesPerSecond(const double& p_targetFramesPerSecond)
+    {
+        m_qualityController.SetTargetFramesPerSecond(p_targetFramesPerSecond);
+    }
+
+    void VideoManager::SetLaneDetectorScale(const Globals::LaneDetectorScales& p_laneDetectorScale)
+    {
+        m_laneDetector.SetScale(p_laneDetectorScale);
+    }
+
     void VideoManager::RunLaneAndObjectDetector()
     {
+        if (!m_resultsFilePath.empty() && !m_resultsWriter.IsOpen())
+        {
+            if (!m_resultsWriter.Open(m_resultsFilePath, m_resultsFormat))
+            {
+                std::cout << std::format("\nERROR: Results file '{}' could not be opened!\n", m_resultsFilePath);
+                std::exit(1);
+            }
+        }
+
+        if (!m_outputVideoFilePath.empty() && !m_videoManagerInformation.m_saveOutput)
+        {
+            ToggleSaveOutput();
+
+            if (!m_videoManagerInformation.m_saveOutput)
+            {
+                std::exit(1);
+            }
+        }
+
+        switch (m_processingMode)
+        {
+        case Globals::ProcessingModes::SEQUENTIAL:
+            if (m_objectDetectorBatchSize > 1)
+            {
+                RunBatched();
+            }
+
+            else
+            {
+                RunSequentially();
+            }
+
+            break;
+
+        case Globals::ProcessingModes::CONCURRENT:
+            RunSequentially();
+            break;
+
+        case Globals::ProcessingModes::PIPELINED:
+            RunPipelined();
+            break;
+
+        default:
+            throw Globals::Exceptions::NotImplementedError();
+        }
+    }
+
+    Performance VideoManager::GetPerformance()
+    {
+        return m_performance;
+    }
+
+    void VideoManager::RunSequentially()
+    {
+        // In concurrent mode the lane detector front-end runs on a worker thread that persists for the whole run rather than a
+        // thread per frame. Each frame is handed to it through one queue and it reports completion, with any exception thrown,
+        // through another.
+        BoundedQueue<const cv::Mat*> laneDetectorFrontEndFrames(1);
+        BoundedQueue<std::exception_ptr> laneDetectorFrontEndResults(1);
+        std::jthread laneDetectorFrontEndWorker;
+
+        if (m_processingMode == Globals::ProcessingModes::CONCURRENT)
+        {
+            laneDetectorFrontEndWorker = std::jthread([this, &laneDetectorFrontEndFrames, &laneDetectorFrontEndResults] {
+                while (std::optional<const cv::Mat*> frame = laneDetectorFrontEndFrames.Pop())
+                {
+                    std::exception_ptr error;
+
+                    try
+                    {
+                        m_laneDetector.RunLaneDetectorFrontEnd(**frame);
+                    }
+
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                    }
+
+                    if (!laneDetectorFrontEndResults.Push(error))
+                    {
+                        break;
+                    }
+                }
+            });
+        }
+
+        // Closing the queues stops the worker before it is joined, however this function is left
+        const ScopeGuard STOP_WORKER([&laneDetectorFrontEndFrames, &laneDetectorFrontEndResults] {
+            laneDetectorFrontEndFrames.Close();
+            laneDetectorFrontEndResults.Close();
+        });
+
         while (true)
         {
             m_performance.StartTimer();
 
-            if (!m_inputVideo.read(m_currentFrame))
+            if (!m_frameReader.Read(m_currentFrame))
             {
                 break;
             }
 
-            m_objectDetector.RunObjectDetector(m_currentFrame);
+            m_performance.UpdateFrameReaderStatistics(m_frameReader.GetQueueDepth(), m_frameReader.GetDroppedFrames());
+
+            if (m_processingMode == Globals::ProcessingModes::CONCURRENT)
+            {
+                // Only the lane detector back-end depends upon the object detector, so the front-end can run during the forward
+                // pass of the object detector
+                laneDetectorFrontEndFrames.Push(&m_currentFrame);
+
+                m_objectDetector.RunObjectDetector(m_currentFrame);
 
-            m_laneDetector.RunLaneDetector(m_currentFrame, m_objectDetector.GetInformation(), m_videoManagerInformation.m_debugMode);
+                const std::optional<std::exception_ptr> LANE_DETECTOR_FRONT_END_ERROR = laneDetectorFrontEndResults.Pop();
 
-            FrameBuilder::UpdateFrame(m_currentFrame, m_objectDetector.GetInformation(), m_laneDetector.GetInformation(), m_performance.GetInformation(), m_videoManagerInformation);
+                if (LANE_DETECTOR_FRONT_END_ERROR.has_value() && *LANE_DETECTOR_FRONT_END_ERROR)
+                {
+                    std::rethrow_exception(*LANE_DETECTOR_FRONT_END_ERROR);
+                }
+            }
 
-            if (m_videoManagerInformation.m_saveOutput)
+            else
             {
-                m_outputVideo.write(m_currentFrame);
-                m_videoManagerInformation.m_saveOutputElapsedTime = Globals::GetTimeElapsed(m_saveOutputStartTime);
+                m_objectDetector.RunObjectDetector(m_currentFrame);
+
+                m_laneDetector.RunLaneDetectorFrontEnd(m_currentFrame);
             }
 
-            cv::imshow("currentFrame", m_currentFrame);
+            m_laneDetector.RunLaneDetectorBackEnd(m_objectDetector.GetInformation());
+
+            OutputFrame(m_currentFrame, m_objectDetector.GetInformation(), m_laneDetector.GetInformation());
+
+            if (!HandleUserInput())
+            {
+                Quit();
+                return;
+            }
+
+            m_performance.EndTimer();
+
+            UpdateObjectDetectorQuality();
+        }
+    }
+
+    void VideoManager::RunBatched()
+    {
+        std::vector<cv::Mat> frames(m_objectDetectorBatchSize);
+        std::vector<ObjectDetectionInformation> objectDetectionInformation;
+
+        while (true)
+        {
+            m_performance.StartTimer();
 
-            if (m_videoManagerInformation.m_debugMode)
+            uint32_t numberOfFrames = 0;
+
+            while (numberOfFrames < m_objectDetectorBatchSize && m_frameReader.Read(frames[numberOfFrames]))
             {
-                cv::imshow("roiFrame", m_laneDetector.GetInformation().m_roiFrame);
-                cv::imshow("cannyFrame", m_laneDetector.GetInformation().m_cannyFrame);
-                cv::imshow("houghLinesFrame", m_laneDetector.GetInformation().m_houghLinesFrame);
+                numberOfFrames++;
             }
 
-            switch (cv::waitKey(1))
+            if (numberOfFrames == 0)
             {
-            case Globals::G_KEY_DEBUG_MODE:
-                ToggleDebugMode();
                 break;
+            }
 
-            case Globals::G_KEY_TOGGLE_SAVE_OUTPUT:
-                ToggleSaveOutput();
-                break;
+            // Only the final batch can be partial as the end of the input video has been reached
+            frames.resize(numberOfFrames);
 
-            case Globals::G_KEY_QUIT:
-                Quit();
-                return;
+            m_performance.UpdateFrameReaderStatistics(m_frameReader.GetQueueDepth(), m_frameReader.GetDroppedFrames());
 
-            default:
-                break;
+            m_objectDetector.RunObjectDetector(frames, objectDetectionInformation);
+
+            for (uint32_t i = 0; i < numberOfFrames; i++)
+            {
+                m_laneDetector.RunLaneDetector(frames[i], objectDetectionInformation[i]);
+
+                OutputFrame(frames[i], objectDetectionInformation[i], m_laneDetector.GetInformation());
+
+                if (!HandleUserInput())
+                {
+                    Quit();
+                    return;
+                }
             }
 
-            m_performance.EndTimer();
+            m_performance.EndTimer(numberOfFrames);
         }
     }
 
-    Performance VideoManager::GetPerformance()
+    void VideoManager::RunPipelined()
     {
-        return m_performance;
+        BoundedQueue<PipelineFrame> objectDetectedFrames(Globals::G_PIPELINE_QUEUE_CAPACITY);
+        BoundedQueue<PipelineFrame> laneDetectedFrames(Globals::G_PIPELINE_QUEUE_CAPACITY);
+
+        // The frame buffers that have left the pipeline are passed back to the object detection stage, which swaps them in to
+        // the frame reader ring buffer so that the capture thread decodes in to them rather than allocating a new frame. There
+        // are enough to fill both queues and each of the three stages, after which no more frames are allocated.
+        const uint32_t NUMBER_OF_PIPELINE_FRAMES = (2 * Globals::G_PIPELINE_QUEUE_CAPACITY) + 3;
+        BoundedQueue<cv::Mat> freeFrames(NUMBER_OF_PIPELINE_FRAMES);
+
+        for (uint32_t i = 0; i < NUMBER_OF_PIPELINE_FRAMES; i++)
+        {
+            freeFrames.Push(cv::Mat());
+        }
+
+        // An exception thrown within a stage is caught and stored rather than terminating the program, then rethrown on the
+        // calling thread once the stages have been joined
+        std::exception_ptr objectDetectionError;
+        std::exception_ptr laneDetectionError;
+
+        // Capture already runs on its own thread within the frame reader, which the object detection stage reads from. Each
+        // stage closes its output queue once its input has been exhausted (or its output queue has been closed) so that the
+        // end of the input video, a user quit and an error all propagate through the whole pipeline.
+        std::jthread objectDetectionStage([this, &freeFrames, &objectDetectedFrames, &objectDetectionError] {
+            try
+            {
+                while (std::optional<cv::Mat> freeFrame = freeFrames.Pop())
+                {
+                    PipelineFrame pipelineFrame;
+                    pipelineFrame.m_frame = std::move(*freeFrame);
+
+                    if (!m_frameReader.Read(pipelineFrame.m_frame))
+                    {
+                        break;
+                    }
+
+                    m_objectDetector.RunObjectDetector(pipelineFrame.m_frame);
+                    pipelineFrame.m_objectDetectionInformation = m_objectDetector.GetInformationSnapshot();
+
+                    if (!objectDetectedFrames.Push(std::move(pipelineFrame)))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            catch (...)
+            {
+                objectDetectionError = std::current_exception();
+            }
+
+            objectDetectedFrames.Close();
+        });
+
+        std::jthread laneDetectionStage([this, &objectDetectedFrames, &laneDetectedFrames, &laneDetectionError] {
+            try
+            {
+                while (std::optional<PipelineFrame> pipelineFrame = objectDetectedFrames.Pop())
+                {
+                    // The lane detector copies on write while the snapshot is held, so its debug frames are never overwritten
+                    // while the output stage is still using them
+                    m_laneDetector.RunLaneDetector(pipelineFrame->m_frame, *pipelineFrame->m_objectDetectionInformation);
+                    pipelineFrame->m_laneDetectionInformation = m_laneDetector.GetInformationSnapshot();
+
+                    if (!laneDetectedFrames.Push(std::move(*pipelineFrame)))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            catch (...)
+            {
+                laneDetectionError = std::current_exception();
+            }
+
+            objectDetectedFrames.Close();
+            laneDetectedFrames.Close();
+        });
+
+        {
+            // However the output stage is left, including by an exception, the queues are closed and the frame reader is
+            // released before the stages are joined, which wakes any stage blocked on them
+            const ScopeGuard STOP_PIPELINE([this, &freeFrames, &objectDetectedFrames, &laneDetectedFrames] {
+                laneDetectedFrames.Close();
+                objectDetectedFrames.Close();
+                freeFrames.Close();
+                m_frameReader.Release();
+            });
+
+            // The frame time in pipelined mode is the time between consecutive frames leaving the pipeline
+            m_performance.StartTimer();
+
+            bool quit = false;
+
+            while (std::optional<PipelineFrame> pipelineFrame = laneDetectedFrames.Pop())
+            {
+                m_performance.UpdateFrameReaderStatistics(m_frameReader.GetQueueDepth(), m_frameReader.GetDroppedFrames());
+
+                OutputFrame(pipelineFrame->m_frame, *pipelineFrame->m_objectDetectionInformation, *pipelineFrame->m_laneDetectionInformation);
+
+                freeFrames.Push(std::move(pipelineFrame->m_frame));
+
+                if (!HandleUserInput())
+                {
+                    quit = true;
+                    break;
+                }
+
+                m_performance.EndTimer();
+                m_performance.StartTimer();
+            }
+
+            if (quit)
+            {
+                Quit();
+            }
+        }
+
+        laneDetectionStage.join();
+        objectDetectionStage.join();
+
+        if (objectDetectionError)
+        {
+            std::rethrow_exception(objectDetectionError);
+        }
+
+        if (laneDetectionError)
+        {
+            std::rethrow_exception(laneDetectionError);
+        }
+    }
+
+    void VideoManager::OutputFrame(cv::Mat& p_frame, const ObjectDetectionInformation& p_objectDetectionInformation, const LaneDetectionInformation& p_laneDetectionInformation)
+    {
+        if (m_resultsWriter.IsOpen())
+        {
+            m_resultsWriter.Write(p_objectDetectionInformation, p_laneDetectionInformation);
+        }
+
+        // When headless the output frame is only consumed by the output video so skip building it if not recording
+        if (m_headless && !m_videoManagerInformation.m_saveOutput)
+        {
+            return;
+        }
+
+        FrameBuilder::UpdateFrame(p_frame, p_objectDetectionInformation, p_laneDetectionInformation, m_performance.GetInformation(), m_videoManagerInformation);
+
+        if (m_videoManagerInformation.m_saveOutput)
+        {
+            m_outputVideo.write(p_frame);
+            m_videoManagerInformation.m_saveOutputElapsedTime = Globals::GetTimeElapsed(m_saveOutputStartTime);
+        }
+
+        if (m_headless)
+        {
+            return;
+        }
+
+        cv::imshow("currentFrame", p_frame);
+
+        // The debug frames are only rendered while the debug windows are open
+        if (m_videoManagerInformation.m_debugMode)
+        {
+            m_debugVisualiser.Show(p_laneDetectionInformation);
+        }
+    }
+
+    bool VideoManager::HandleUserInput()
+    {
+        // There is no window to receive keyboard input from when headless, which also means frames are not paced by `waitKey()`
+        if (m_headless)
+        {
+            return true;
+        }
+
+        switch (cv::waitKey(1))
+        {
+        case Globals::G_KEY_DEBUG_MODE:
+            ToggleDebugMode();
+            break;
+
+        case Globals::G_KEY_TOGGLE_SAVE_OUTPUT:
+            ToggleSaveOutput();
+            break;
+
+        case Globals::G_KEY_QUIT:
+            return false;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    void VideoManager::UpdateFrameGeometry()
+    {
+        const cv::Size FRAME_SIZE = m_frameReader.GetFrameSize();
+
+        if (FRAME_SIZE.empty())
+        {
+            std::cout << "\nERROR: No frames could be read from the input video stream!\n";
+            std::exit(1);
+        }
+
+        m_videoManagerInformation.m_frameGeometry = FrameGeometry(FRAME_SIZE);
+        m_laneDetector.SetFrameGeometry(m_videoManagerInformation.m_frameGeometry);
+    }
+
+    void VideoManager::UpdateObjectDetectorQuality()
+    {
+        if (!m_qualityController.IsEnabled())
+        {
+            return;
+        }
+
+        m_qualityController.Update(m_performance.GetLastFrameTime());
+
+        const uint32_t REQUESTED_LEVEL = m_qualityController.GetRequestedLevel();
+
+        if (REQUESTED_LEVEL != m_qualityController.GetLevel())
+        {
+            // The current network keeps running until the requested one has finished loading in the background
+            if (m_objectDetector.SwitchNetwork(Globals::G_QUALITY_CONTROLLER_OBJECT_DETECTOR_TYPES[REQUESTED_LEVEL], Globals::G_QUALITY_CONTROLLER_BLOB_SIZES[REQUESTED_LEVEL]))
+            {
+                m_qualityController.SetLevel(REQUESTED_LEVEL);
+            }
+
+            return;
+        }
+
+        const uint32_t PRELOAD_LEVEL = m_qualityController.GetPreloadLevel();
+        m_objectDetector.PreloadNetwork(Globals::G_QUALITY_CONTROLLER_OBJECT_DETECTOR_TYPES[PRELOAD_LEVEL], Globals::G_QUALITY_CONTROLLER_BLOB_SIZES[PRELOAD_LEVEL]);
     }
 
     void VideoManager::ToggleDebugMode()
@@ -292,9 +928,7 @@ namespace LaneAndObjectDetection
 
         if (!m_videoManagerInformation.m_debugMode)
         {
-            cv::destroyWindow("roiFrame");
-            cv::destroyWindow("cannyFrame");
-            cv::destroyWindow("houghLinesFrame");
+            DebugVisualiser::Close();
         }
     }
 
@@ -306,12 +940,12 @@ namespace LaneAndObjectDetection
         {
             m_saveOutputStartTime = std::chrono::high_resolution_clock::now();
 
-            const std::string OUTPUT_FILE_NAME = std::format("{:%Y-%m-%d-%H-%M-%S}-output.mp4", std::chrono::system_clock::now());
+            const std::string OUTPUT_FILE_NAME = m_outputVideoFilePath.empty() ? std::format("{:%Y-%m-%d-%H-%M-%S}-output.mp4", std::chrono::system_clock::now()) : m_outputVideoFilePath;
 
             m_outputVideo.open(OUTPUT_FILE_NAME,
                                cv::VideoWriter::fourcc('m', 'p', '4', 'v'),
                                Globals::G_VIDEO_OUTPUT_FPS,
-                               cv::Size(Globals::G_VIDEO_OUTPUT_WIDTH, Globals::G_VIDEO_OUTPUT_HEIGHT));
+                               m_videoManagerInformation.m_frameGeometry.m_frameSize);
 
             if (!m_outputVideo.isOpened())
             {
@@ -334,8 +968,13 @@ namespace LaneAndObjectDetection
 
     void VideoManager::Quit()
     {
-        m_inputVideo.release();
+        m_frameReader.Release();
         m_outputVideo.release();
-        cv::destroyAllWindows();
+        m_resultsWriter.Close();
+
+        if (!m_headless)
+        {
+            cv::destroyAllWindows();
+        }
     }
 }
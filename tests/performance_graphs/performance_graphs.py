@@ -63,7 +63,7 @@ def __init__(self, database_file_paths: str, graph_output_directory: str):
         self.TICK_FONT_SIZE: int = 14
         self.LEGEND_FONT_SIZE: int = 14
 
-        self.BAR_WIDTH: float = 0.25
+        self.BAR_WIDTH: float = 0.2
 
         self.FIGURE_WIDTH: int = 16
         self.FIGURE_HEIGHT: int = 9
@@ -139,8 +139,9 @@ def __generate_platform_performance_graphs(self, database_data: tuple[FrameTimeD
         else:
             x_axis = numpy.arange(len(frames_per_second_data.test_names))[1:]
             x_ticks = numpy.arange(len(frames_per_second_data.test_names))
-            multiplier = -0.5
             fps_data = dict(list(frames_per_second_data.average_frames_per_second.items())[1:])
+            # Center the bars of all backends on each tick
+            multiplier = -(len(fps_data) - 1) / 2
 
             rects = axes_bar.bar(
                 x=frames_per_second_data.test_names[0],
@@ -341,11 +342,11 @@ def __validate_data(self) -> None:
                         FROM
                             FrameTimes
                         WHERE
-                            ObjectDetectorBackEnd NOT IN (0, 1, 2, 3)
+                            ObjectDetectorBackEnd NOT IN (0, 1, 2, 3, 4, 5)
                         """
                     )
                     if len(sqlite_cursor.fetchall()) > 0:
-                        error_message += f"\n{database_file_path}: Expected a values between 0, 1, and 2 for ObjectDetectorBackEnd but got other values!"
+                        error_message += f"\n{database_file_path}: Expected a values between 0, 1, 2, 3, 4 and 5 for ObjectDetectorBackEnd but got other values!"
 
                     sqlite_cursor.execute(
                         """
@@ -602,6 +603,8 @@ def __get_platform_specific_data(
                 frame_times[f"{yolo_name} (CPU)"] = []
                 frame_times[f"{yolo_name} (GPU)"] = []
                 frame_times[f"{yolo_name} (CUDA)"] = []
+                frame_times[f"{yolo_name} (CPU FP16)"] = []
+                frame_times[f"{yolo_name} (CPU INT8)"] = []
 
                 for test in all_tests:
                     sqlite_cursor.execute(
@@ -627,6 +630,10 @@ def __get_platform_specific_data(
                         frame_times[f"{yolo_name} (GPU)"].append([row[0] for row in sqlite_cursor.fetchall()])
                     elif test[1] == 3:
                         frame_times[f"{yolo_name} (CUDA)"].append([row[0] for row in sqlite_cursor.fetchall()])
+                    elif test[1] == 4:
+                        frame_times[f"{yolo_name} (CPU FP16)"].append([row[0] for row in sqlite_cursor.fetchall()])
+                    elif test[1] == 5:
+                        frame_times[f"{yolo_name} (CPU INT8)"].append([row[0] for row in sqlite_cursor.fetchall()])
 
             except sqlite3.Error as e:
                 raise e
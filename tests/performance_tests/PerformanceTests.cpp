@@ -1,34 +1,100 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <format>
 #include <iostream>
+#include <memory>
+#include <new>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <opencv2/core.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <opencv2/dnn/dnn.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
 #include <sqlite3.h>
 
+#include "detectors/HoughLineClassifier.hpp"
+#include "detectors/LetterboxPreprocessor.hpp"
+#include "detectors/NetworkCache.hpp"
+#include "detectors/NonMaximaSuppression.hpp"
+#include "detectors/ObjectDetector.hpp"
+#include "detectors/ObjectOccupancyMask.hpp"
+#include "detectors/ObjectTracker.hpp"
+#include "helpers/FrameGeometry.hpp"
 #include "helpers/Globals.hpp"
+#include "helpers/ImageKernels.hpp"
+#include "helpers/Information.hpp"
+#include "helpers/QualityController.hpp"
 #include "helpers/VideoManager.hpp"
 
 #include "PerformanceTests.hpp"
 
+namespace
+{
+    /**
+     * @brief The number of heap allocations made through the global `operator new` (and therefore by all standard
+     * containers and strings). OpenCV allocates `cv::Mat` data through its own allocator, which is not counted.
+     */
+    std::atomic<uint64_t> numberOfAllocations = 0;
+}
+
+void* operator new(std::size_t p_size)
+{
+    numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* pointer = std::malloc(p_size == 0 ? 1 : p_size))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p_pointer) noexcept
+{
+    std::free(p_pointer);
+}
+
+void operator delete(void* p_pointer, std::size_t /*p_size*/) noexcept
+{
+    std::free(p_pointer);
+}
+
 /**
  * @namespace LaneAndObjectDetection
  * @brief Contains all Lane-and-Object-Detection objects.
  */
 namespace LaneAndObjectDetection
 {
-    PerformanceTests::PerformanceTests(std::string p_currentPlatform, std::string p_databasePath, std::string p_inputVideoFilePath, std::string p_yoloFolderPath, const uint32_t& p_numberOfRepetitions) :
+    PerformanceTests::PerformanceTests(std::string p_currentPlatform,
+                                       std::string p_databasePath,
+                                       std::string p_inputVideoFilePath,
+                                       std::string p_yoloFolderPath,
+                                       const uint32_t& p_numberOfRepetitions,
+                                       const bool& p_runChecks,
+                                       const bool& p_includeQuantisedBackEnds) :
         m_currentPlatform(std::move(p_currentPlatform)),
         m_databasePath(std::move(p_databasePath)),
         m_inputVideoFilePath(std::move(p_inputVideoFilePath)),
         m_yoloFolderPath(std::move(p_yoloFolderPath)),
-        m_numberOfRepetitions(p_numberOfRepetitions)
+        m_numberOfRepetitions(p_numberOfRepetitions),
+        m_runChecks(p_runChecks),
+        m_includeQuantisedBackEnds(p_includeQuantisedBackEnds)
     {}
 
-    PerformanceTests::PerformanceTests(const std::vector<std::string>& p_commandLineArguments)
+    PerformanceTests::PerformanceTests(const std::vector<std::string>& p_commandLineArguments) :
+        m_numberOfRepetitions(0),
+        m_runChecks(false),
+        m_includeQuantisedBackEnds(false)
     {
         uint32_t index = 0;
 
@@ -69,6 +135,16 @@ namespace LaneAndObjectDetection
                     m_numberOfRepetitions = std::stoi(p_commandLineArguments.at(index + 1));
                     numberOfRepetitionsGiven = true;
                 }
+
+                if (argument == "-c" || argument == "--checks")
+                {
+                    m_runChecks = true;
+                }
+
+                if (argument == "-q" || argument == "--quantised")
+                {
+                    m_includeQuantisedBackEnds = true;
+                }
             }
 
             catch (...)
@@ -80,8 +156,9 @@ namespace LaneAndObjectDetection
             index++;
         }
 
-        // Check that the required arguments have been provided
-        if (m_currentPlatform.empty() || m_databasePath.empty() || m_inputVideoFilePath.empty() || m_yoloFolderPath.empty() || !numberOfRepetitionsGiven)
+        // Check that the required arguments have been provided, where the checks do not record any frame times
+        if (m_inputVideoFilePath.empty() || m_yoloFolderPath.empty() ||
+            (!m_runChecks && (m_currentPlatform.empty() || m_databasePath.empty() || !numberOfRepetitionsGiven)))
         {
             std::cout << Globals::G_PERFORMANCE_TESTS_CLI_HELP_MESSAGE;
             std::exit(1);
@@ -91,9 +168,18 @@ namespace LaneAndObjectDetection
     void PerformanceTests::RunPerformanceTests()
     {
         std::cout << "\n################ Lane and Object Detection Performance Tests ################";
+
+        if (m_runChecks)
+        {
+            RunChecks();
+            std::cout << "\n\n################ Lane and Object Detection Performance Tests ################\n";
+            return;
+        }
+
         std::cout << "\nSettings:";
         std::cout << "\n    Number of tests: " << Globals::G_PERFORMANCE_TESTS_NUMBER_OF_TESTS;
         std::cout << "\n    Number of repetitions: " << m_numberOfRepetitions;
+        std::cout << "\n    Quantised backends: " << (m_includeQuantisedBackEnds ? "included" : "skipped");
 
         std::cout << "\nOpening the database...";
         m_sqliteDatabase.OpenDatabase(m_databasePath);
@@ -102,6 +188,9 @@ namespace LaneAndObjectDetection
 
         VideoManager videoManager;
 
+        // The INT8 backend is quantised using the calibration frames, which a fresh checkout does not have
+        const bool HAS_CALIBRATION_FRAMES = NetworkCache::HasCalibrationFrames(m_yoloFolderPath);
+
         for (uint32_t currentTestNumber = 0; currentTestNumber < Globals::G_PERFORMANCE_TESTS_NUMBER_OF_TESTS; currentTestNumber++)
         {
             std::cout << std::format("\n\n    ######## {} ({}/{}) ########\n",
@@ -109,6 +198,20 @@ namespace LaneAndObjectDetection
                                      currentTestNumber,
                                      Globals::G_PERFORMANCE_TESTS_NUMBER_OF_TESTS);
 
+            const Globals::ObjectDetectorBackEnds BACK_END = Globals::G_PERFORMANCE_TESTS_BACK_END_TYPES.at(currentTestNumber);
+
+            if ((BACK_END == Globals::ObjectDetectorBackEnds::CPU_FP16 || BACK_END == Globals::ObjectDetectorBackEnds::CPU_INT8) && !m_includeQuantisedBackEnds)
+            {
+                std::cout << "\n        Skipped as the quantised backends were not requested";
+                continue;
+            }
+
+            if (BACK_END == Globals::ObjectDetectorBackEnds::CPU_INT8 && !HAS_CALIBRATION_FRAMES)
+            {
+                std::cout << "\n        Skipped as the YOLO folder does not contain any calibration frames";
+                continue;
+            }
+
             for (uint32_t currentRepetition = 0; currentRepetition < m_numberOfRepetitions; currentRepetition++)
             {
                 videoManager.SetProperties(m_inputVideoFilePath,
@@ -138,6 +241,1049 @@ namespace LaneAndObjectDetection
         std::cout << "\n\n################ Lane and Object Detection Performance Tests ################\n";
     }
 
+    void PerformanceTests::RunChecks()
+    {
+        RunPostProcessingAllocationTest();
+        RunNonMaximaSuppressionBenchmark();
+        RunGreyConversionBenchmark();
+        RunObjectOccupancyMaskTest();
+        RunHoughLineClassifierTest();
+        RunStripedCannyTest();
+        RunLetterboxTest();
+        RunObjectTrackerTest();
+        RunQualityControllerTest();
+        RunQuantisationDriftTest();
+        RunHorizonCropTest();
+    }
+
+    void PerformanceTests::RunPostProcessingAllocationTest()
+    {
+        std::cout << "\n\n    ######## Object Detector Post-Processing Allocations ########\n";
+
+        const std::vector<cv::Mat> OUTPUT_BLOBS = CreateSyntheticOutputBlobs();
+
+        ObjectDetector objectDetector;
+        ObjectDetectionInformation objectDetectionInformation;
+
+        // The first frames grow the reusable buffers to their steady state size
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_WARM_UP_ITERATIONS; i++)
+        {
+            objectDetector.DecodeOutputBlobs(OUTPUT_BLOBS, objectDetectionInformation);
+        }
+
+        // Every frame run by the timing, including its own warm-up, is counted
+        const uint64_t NUMBER_OF_ALLOCATIONS_BEFORE = numberOfAllocations.load();
+
+        const double ELAPSED_TIME = TimePerFrame([&]() {
+            objectDetector.DecodeOutputBlobs(OUTPUT_BLOBS, objectDetectionInformation);
+        });
+
+        const uint64_t NUMBER_OF_ALLOCATIONS = numberOfAllocations.load() - NUMBER_OF_ALLOCATIONS_BEFORE;
+
+        std::cout << std::format("\n        {} objects detected in {:.2f} {} per frame with {} heap allocations over {} frames",
+                                 objectDetectionInformation.m_objectInformation.size(),
+                                 ELAPSED_TIME,
+                                 Globals::G_TIME_UNIT,
+                                 NUMBER_OF_ALLOCATIONS,
+                                 Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_WARM_UP_ITERATIONS + Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_ITERATIONS);
+
+        if (NUMBER_OF_ALLOCATIONS != 0)
+        {
+            std::cout << "\nERROR: The object detector post-processing made heap allocations after warming up!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+
+        const std::vector<cv::Mat> FRAMES = ReadBenchmarkFrames(1);
+
+        if (FRAMES.empty())
+        {
+            std::cout << "\nERROR: No frames could be read from the input video file!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+
+        const cv::Mat& FRAME = FRAMES.front();
+
+        // The allocations made by OpenCV within the forward pass of the same network on the same blob are the baseline
+        NetworkCache networkCache;
+        cv::dnn::Net net = networkCache.GetNetwork(m_yoloFolderPath, Globals::G_PERFORMANCE_TESTS_ALLOCATION_OBJECT_DETECTOR_TYPE, Globals::ObjectDetectorBackEnds::CPU, Globals::G_PERFORMANCE_TESTS_ALLOCATION_BLOB_SIZE).m_net;
+        const std::vector<std::string> UNCONNECTED_OUTPUT_LAYER_NAMES = net.getUnconnectedOutLayersNames();
+
+        LetterboxPreprocessor letterboxPreprocessor;
+        letterboxPreprocessor.Run(FRAME, static_cast<int32_t>(Globals::G_PERFORMANCE_TESTS_ALLOCATION_BLOB_SIZE));
+        std::vector<cv::Mat> outputBlobs;
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_WARM_UP_ITERATIONS; i++)
+        {
+            net.setInput(letterboxPreprocessor.GetBlob());
+            net.forward(outputBlobs, UNCONNECTED_OUTPUT_LAYER_NAMES);
+        }
+
+        const uint64_t NUMBER_OF_FORWARD_ALLOCATIONS_BEFORE = numberOfAllocations.load();
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_ALLOCATION_ITERATIONS; i++)
+        {
+            net.setInput(letterboxPreprocessor.GetBlob());
+            net.forward(outputBlobs, UNCONNECTED_OUTPUT_LAYER_NAMES);
+        }
+
+        const uint64_t NUMBER_OF_FORWARD_ALLOCATIONS = numberOfAllocations.load() - NUMBER_OF_FORWARD_ALLOCATIONS_BEFORE;
+
+        // The snapshots are held for as many frames as they can be in the pipeline, so that the object detector has to write
+        // each frame to a struct other than the one last handed out
+        objectDetector.SetProperties(m_yoloFolderPath, Globals::G_PERFORMANCE_TESTS_ALLOCATION_OBJECT_DETECTOR_TYPE, Globals::ObjectDetectorBackEnds::CPU, Globals::G_PERFORMANCE_TESTS_ALLOCATION_BLOB_SIZE);
+
+        std::vector<std::shared_ptr<const ObjectDetectionInformation>> heldSnapshots(Globals::G_PERFORMANCE_TESTS_ALLOCATION_HELD_SNAPSHOTS);
+        uint32_t frameNumber = 0;
+
+        const auto RUN_OBJECT_DETECTOR = [&]() {
+            objectDetector.RunObjectDetector(FRAME);
+            heldSnapshots[frameNumber % heldSnapshots.size()] = objectDetector.GetInformationSnapshot();
+            frameNumber++;
+        };
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_ALLOCATION_HELD_SNAPSHOTS + Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_WARM_UP_ITERATIONS; i++)
+        {
+            RUN_OBJECT_DETECTOR();
+        }
+
+        const uint64_t NUMBER_OF_OBJECT_DETECTOR_ALLOCATIONS_BEFORE = numberOfAllocations.load();
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_ALLOCATION_ITERATIONS; i++)
+        {
+            RUN_OBJECT_DETECTOR();
+        }
+
+        const uint64_t NUMBER_OF_OBJECT_DETECTOR_ALLOCATIONS = numberOfAllocations.load() - NUMBER_OF_OBJECT_DETECTOR_ALLOCATIONS_BEFORE;
+
+        std::cout << std::format("\n        The object detector made {} heap allocations over {} frames while holding {} snapshots, against {} by the forward pass alone",
+                                 NUMBER_OF_OBJECT_DETECTOR_ALLOCATIONS,
+                                 Globals::G_PERFORMANCE_TESTS_ALLOCATION_ITERATIONS,
+                                 Globals::G_PERFORMANCE_TESTS_ALLOCATION_HELD_SNAPSHOTS,
+                                 NUMBER_OF_FORWARD_ALLOCATIONS);
+
+        if (NUMBER_OF_OBJECT_DETECTOR_ALLOCATIONS > NUMBER_OF_FORWARD_ALLOCATIONS)
+        {
+            std::cout << "\nERROR: The object detector made heap allocations outside of the forward pass after warming up!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+    }
+
+    std::vector<cv::Mat> PerformanceTests::CreateSyntheticOutputBlobs()
+    {
+        const int32_t NUMBER_OF_COLUMNS = Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECT_SCORES_START_INDEX + Globals::G_OBJECT_DETECTOR_NUMBER_OF_DETECTABLE_OBJECTS;
+        const float MINIMUM_CENTER = 0.1F;
+        const float MAXIMUM_CENTER_Y = 0.5F;
+        const float MINIMUM_SIZE = 0.02F;
+        const float MAXIMUM_SIZE = 0.1F;
+
+        cv::RNG randomNumberGenerator(Globals::G_PERFORMANCE_TESTS_RANDOM_SEED);
+        std::vector<cv::Mat> outputBlobs;
+
+        for (const int32_t& numberOfRows : Globals::G_PERFORMANCE_TESTS_SYNTHETIC_OUTPUT_BLOB_ROWS)
+        {
+            cv::Mat outputBlob(numberOfRows, NUMBER_OF_COLUMNS, CV_32F);
+            randomNumberGenerator.fill(outputBlob, cv::RNG::UNIFORM, 0.0F, Globals::G_PERFORMANCE_TESTS_SYNTHETIC_BACKGROUND_SCORE);
+
+            for (int32_t rowIndex = 0; rowIndex < numberOfRows; rowIndex += Globals::G_PERFORMANCE_TESTS_SYNTHETIC_DETECTION_ROW_INTERVAL)
+            {
+                float* row = outputBlob.ptr<float>(rowIndex);
+
+                row[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_CENTER_X_COORD_INDEX] = randomNumberGenerator.uniform(MINIMUM_CENTER, 1.0F - MINIMUM_CENTER);
+                row[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_CENTER_Y_COORD_INDEX] = randomNumberGenerator.uniform(MINIMUM_CENTER, MAXIMUM_CENTER_Y);
+                row[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_WIDTH_INDEX] = randomNumberGenerator.uniform(MINIMUM_SIZE, MAXIMUM_SIZE);
+                row[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_HEIGHT_INDEX] = randomNumberGenerator.uniform(MINIMUM_SIZE, MAXIMUM_SIZE);
+                row[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECTNESS_INDEX] = Globals::G_PERFORMANCE_TESTS_SYNTHETIC_OBJECTNESS_SCORE;
+                row[Globals::G_OBJECT_DETECTOR_OUTPUT_BLOBS_OBJECT_SCORES_START_INDEX + (rowIndex % Globals::G_OBJECT_DETECTOR_NUMBER_OF_DETECTABLE_OBJECTS)] = Globals::G_PERFORMANCE_TESTS_SYNTHETIC_CLASS_SCORE;
+            }
+
+            outputBlobs.push_back(outputBlob);
+        }
+
+        return outputBlobs;
+    }
+
+    void PerformanceTests::RunNonMaximaSuppressionBenchmark()
+    {
+        std::cout << "\n\n    ######## Object Detector Non-Maxima Suppression ########\n";
+
+        const int32_t MINIMUM_SIZE = 20;
+        const int32_t MAXIMUM_SIZE = 160;
+        const int32_t JITTER = Globals::G_PERFORMANCE_TESTS_NMS_MAXIMUM_JITTER;
+        const float NMS_THRESHOLD = static_cast<float>(Globals::G_OBJECT_DETECTOR_NMS_THRESHOLD);
+        const uint32_t TOP_K = 10;
+
+        cv::RNG randomNumberGenerator(Globals::G_PERFORMANCE_TESTS_RANDOM_SEED);
+        std::vector<cv::Rect> objects;
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_NMS_NUMBER_OF_OBJECTS; i++)
+        {
+            objects.emplace_back(randomNumberGenerator.uniform(0, static_cast<int32_t>(Globals::G_VIDEO_INPUT_WIDTH) - MAXIMUM_SIZE),
+                                 randomNumberGenerator.uniform(0, static_cast<int32_t>(Globals::G_VIDEO_INPUT_HEIGHT) - MAXIMUM_SIZE),
+                                 randomNumberGenerator.uniform(MINIMUM_SIZE, MAXIMUM_SIZE),
+                                 randomNumberGenerator.uniform(MINIMUM_SIZE, MAXIMUM_SIZE));
+        }
+
+        // Each object is detected many times with jittered bounding boxes, as YOLO does across neighbouring anchors and
+        // scales, and some of those detections are of a neighbouring class, as happens between cars and trucks
+        std::vector<cv::Rect> boundingBoxes;
+        std::vector<uint32_t> classIds;
+        std::vector<int32_t> referenceClassIds;
+        std::vector<float> confidences;
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_NMS_NUMBER_OF_CANDIDATES; i++)
+        {
+            const uint32_t OBJECT_INDEX = i % Globals::G_PERFORMANCE_TESTS_NMS_NUMBER_OF_OBJECTS;
+            const cv::Rect& OBJECT = objects[OBJECT_INDEX];
+
+            boundingBoxes.emplace_back(OBJECT.x + randomNumberGenerator.uniform(-JITTER, JITTER + 1),
+                                       OBJECT.y + randomNumberGenerator.uniform(-JITTER, JITTER + 1),
+                                       OBJECT.width + randomNumberGenerator.uniform(-JITTER, JITTER + 1),
+                                       OBJECT.height + randomNumberGenerator.uniform(-JITTER, JITTER + 1));
+            classIds.push_back((OBJECT_INDEX + ((i % Globals::G_PERFORMANCE_TESTS_NMS_NUMBER_OF_CLASSES) == 0 ? 1 : 0)) % Globals::G_PERFORMANCE_TESTS_NMS_NUMBER_OF_CLASSES);
+            referenceClassIds.push_back(static_cast<int32_t>(classIds.back()));
+            confidences.push_back(randomNumberGenerator.uniform(static_cast<float>(Globals::G_OBJECT_DETECTOR_CONFIDENCE_THRESHOLD), 1.0F));
+        }
+
+        NonMaximaSuppression nonMaximaSuppression;
+        std::vector<int32_t> referenceIndices;
+
+        // Whether exactly the same candidates are kept by both
+        const auto IS_MATCHING = [](std::vector<uint32_t> p_actualIndices, const std::vector<int32_t>& p_expectedIndices) {
+            std::vector<uint32_t> expectedIndices(p_expectedIndices.begin(), p_expectedIndices.end());
+
+            std::sort(p_actualIndices.begin(), p_actualIndices.end());
+            std::sort(expectedIndices.begin(), expectedIndices.end());
+
+            return p_actualIndices == expectedIndices;
+        };
+
+        const double AGNOSTIC_EXPECTED_ELAPSED_TIME = TimePerFrame([&]() {
+            cv::dnn::NMSBoxes(boundingBoxes, confidences, 0.0F, NMS_THRESHOLD, referenceIndices);
+        });
+
+        const double AGNOSTIC_ACTUAL_ELAPSED_TIME = TimePerFrame([&]() {
+            nonMaximaSuppression.Run(boundingBoxes, classIds, confidences, NMS_THRESHOLD, false, 0);
+        });
+
+        const bool IS_AGNOSTIC_MATCHING = IS_MATCHING(nonMaximaSuppression.GetKeptIndices(), referenceIndices);
+        const std::size_t NUMBER_OF_AGNOSTIC_KEPT = nonMaximaSuppression.GetKeptIndices().size();
+
+        const double AWARE_EXPECTED_ELAPSED_TIME = TimePerFrame([&]() {
+            cv::dnn::NMSBoxesBatched(boundingBoxes, confidences, referenceClassIds, 0.0F, NMS_THRESHOLD, referenceIndices);
+        });
+
+        const double AWARE_ACTUAL_ELAPSED_TIME = TimePerFrame([&]() {
+            nonMaximaSuppression.Run(boundingBoxes, classIds, confidences, NMS_THRESHOLD, true, 0);
+        });
+
+        const bool IS_AWARE_MATCHING = IS_MATCHING(nonMaximaSuppression.GetKeptIndices(), referenceIndices);
+        const std::vector<uint32_t> AWARE_KEPT_INDICES = nonMaximaSuppression.GetKeptIndices();
+
+        const double TOP_K_ELAPSED_TIME = TimePerFrame([&]() {
+            nonMaximaSuppression.Run(boundingBoxes, classIds, confidences, NMS_THRESHOLD, true, TOP_K);
+        });
+
+        // Stopping early must keep the same candidates as the full search up to the limit
+        const std::size_t NUMBER_OF_TOP_K_EXPECTED = std::min<std::size_t>(TOP_K, AWARE_KEPT_INDICES.size());
+        const bool IS_TOP_K_MATCHING = nonMaximaSuppression.GetKeptIndices().size() == NUMBER_OF_TOP_K_EXPECTED &&
+                                       std::equal(AWARE_KEPT_INDICES.begin(), AWARE_KEPT_INDICES.begin() + static_cast<std::ptrdiff_t>(NUMBER_OF_TOP_K_EXPECTED), nonMaximaSuppression.GetKeptIndices().begin());
+
+        ReportComparison("Class-agnostic: cv::dnn::NMSBoxes",
+                         AGNOSTIC_EXPECTED_ELAPSED_TIME,
+                         "the vectorised NMS",
+                         AGNOSTIC_ACTUAL_ELAPSED_TIME,
+                         std::format("keeping {} of {} candidates", NUMBER_OF_AGNOSTIC_KEPT, boundingBoxes.size()),
+                         IS_AGNOSTIC_MATCHING,
+                         "The vectorised non-maxima suppression does not match cv::dnn::NMSBoxes");
+
+        ReportComparison("Class-aware: cv::dnn::NMSBoxesBatched",
+                         AWARE_EXPECTED_ELAPSED_TIME,
+                         "the vectorised NMS",
+                         AWARE_ACTUAL_ELAPSED_TIME,
+                         std::format("keeping {} of {} candidates", AWARE_KEPT_INDICES.size(), boundingBoxes.size()),
+                         IS_AWARE_MATCHING,
+                         "The vectorised non-maxima suppression does not match cv::dnn::NMSBoxesBatched");
+
+        std::cout << std::format("\n        Class-aware with a top-K of {}: the vectorised NMS took {:.2f} {} per frame", TOP_K, TOP_K_ELAPSED_TIME, Globals::G_TIME_UNIT);
+
+        if (!IS_TOP_K_MATCHING)
+        {
+            std::cout << "\nERROR: The top-K non-maxima suppression does not keep the highest confidence candidates!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+    }
+
+    void PerformanceTests::RunGreyConversionBenchmark()
+    {
+        std::cout << "\n\n    ######## Lane Detector Masked Grey Conversion ########\n";
+
+        cv::Mat frame(Globals::G_VIDEO_INPUT_HEIGHT, Globals::G_VIDEO_INPUT_WIDTH, CV_8UC3);
+        cv::RNG randomNumberGenerator(Globals::G_PERFORMANCE_TESTS_RANDOM_SEED);
+        randomNumberGenerator.fill(frame, cv::RNG::UNIFORM, 0, UINT8_MAX + 1);
+
+        const cv::Mat ROI_BOUNDING_BOX = frame(Globals::G_ROI_BOUNDING_BOX_Y_RANGE, Globals::G_ROI_BOUNDING_BOX_X_RANGE);
+
+        // The previous approach of masking with a rasterised ROI mask and then converting to grey
+        std::array<cv::Point, Globals::G_NUMBER_OF_POINTS> roiMaskPoints = Globals::G_ROI_MASK_POINTS;
+        for (cv::Point& roiMaskPoint : roiMaskPoints)
+        {
+            roiMaskPoint -= Globals::G_ROI_BOUNDING_BOX_ORIGIN;
+        }
+
+        cv::Mat roiMask = cv::Mat::zeros(Globals::G_ROI_BOUNDING_BOX_SIZE, CV_8UC1);
+        cv::fillConvexPoly(roiMask, roiMaskPoints, Globals::G_COLOUR_WHITE);
+
+        cv::Mat expectedFrame;
+
+        const double EXPECTED_ELAPSED_TIME = TimePerFrame([&]() {
+            cv::cvtColor(ROI_BOUNDING_BOX, expectedFrame, cv::COLOR_BGR2GRAY);
+            cv::bitwise_and(expectedFrame, roiMask, expectedFrame);
+        });
+
+        std::vector<cv::Range> roiRowSpans;
+        ImageKernels::ComputeTrapezoidRowSpans(Globals::G_ROI_MASK_POINTS, cv::Rect(Globals::G_ROI_BOUNDING_BOX_ORIGIN, Globals::G_ROI_BOUNDING_BOX_SIZE), roiRowSpans);
+
+        cv::Mat actualFrame;
+
+        const double ACTUAL_ELAPSED_TIME = TimePerFrame([&]() {
+            ImageKernels::ConvertMaskedBgrToGrey(ROI_BOUNDING_BOX, roiRowSpans, actualFrame);
+        });
+
+        // Pixels may only differ at the edges of the ROI, where the mask can be rasterised differently
+        int32_t numberOfDifferences = 0;
+
+        for (int32_t row = 0; row < expectedFrame.rows; row++)
+        {
+            for (int32_t column = 0; column < expectedFrame.cols; column++)
+            {
+                if (expectedFrame.at<uint8_t>(row, column) != actualFrame.at<uint8_t>(row, column))
+                {
+                    numberOfDifferences++;
+                }
+            }
+        }
+
+        ReportComparison("Masked cv::cvtColor",
+                         EXPECTED_ELAPSED_TIME,
+                         "the fused kernel",
+                         ACTUAL_ELAPSED_TIME,
+                         std::format("with {} differing pixels", numberOfDifferences),
+                         numberOfDifferences <= expectedFrame.rows * Globals::G_PERFORMANCE_TESTS_GREY_CONVERSION_MAXIMUM_EDGE_DIFFERENCES_PER_ROW,
+                         "The fused grey conversion does not match the masked cv::cvtColor");
+    }
+
+    void PerformanceTests::RunObjectOccupancyMaskTest()
+    {
+        std::cout << "\n\n    ######## Lane Detector Object Occupancy Mask ########\n";
+
+        const int32_t MINIMUM_SIZE = 20;
+        const int32_t MAXIMUM_SIZE = 200;
+        const cv::Rect ROI_BOUNDING_BOX = cv::Rect(Globals::G_ROI_BOUNDING_BOX_ORIGIN, Globals::G_ROI_BOUNDING_BOX_SIZE);
+
+        // The ends of some lines and parts of some bounding boxes fall outside of the ROI bounding box
+        const cv::Rect LINE_REGION = cv::Rect(ROI_BOUNDING_BOX.x - MINIMUM_SIZE, ROI_BOUNDING_BOX.y - MINIMUM_SIZE, ROI_BOUNDING_BOX.width + (2 * MINIMUM_SIZE), ROI_BOUNDING_BOX.height + (2 * MINIMUM_SIZE));
+
+        cv::RNG randomNumberGenerator(Globals::G_PERFORMANCE_TESTS_RANDOM_SEED);
+        ObjectDetectionInformation objectDetectionInformation;
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_OCCUPANCY_MASK_NUMBER_OF_OBJECTS; i++)
+        {
+            objectDetectionInformation.m_objectInformation.push_back({.m_boundingBox = cv::Rect(randomNumberGenerator.uniform(LINE_REGION.x - MAXIMUM_SIZE, LINE_REGION.br().x),
+                                                                                                 randomNumberGenerator.uniform(LINE_REGION.y - MAXIMUM_SIZE, LINE_REGION.br().y),
+                                                                                                 randomNumberGenerator.uniform(MINIMUM_SIZE, MAXIMUM_SIZE),
+                                                                                                 randomNumberGenerator.uniform(MINIMUM_SIZE, MAXIMUM_SIZE)),
+                                                                      .m_boundingBoxColour = Globals::G_COLOUR_WHITE,
+                                                                      .m_classId = 0,
+                                                                      .m_confidence = 1});
+        }
+
+        std::vector<cv::Vec4i> houghLines;
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_OCCUPANCY_MASK_NUMBER_OF_LINES; i++)
+        {
+            houghLines.emplace_back(randomNumberGenerator.uniform(LINE_REGION.x, LINE_REGION.br().x),
+                                    randomNumberGenerator.uniform(LINE_REGION.y, LINE_REGION.br().y),
+                                    randomNumberGenerator.uniform(LINE_REGION.x, LINE_REGION.br().x),
+                                    randomNumberGenerator.uniform(LINE_REGION.y, LINE_REGION.br().y));
+        }
+
+        const FrameGeometry FRAME_GEOMETRY(cv::Size(Globals::G_VIDEO_INPUT_WIDTH, Globals::G_VIDEO_INPUT_HEIGHT));
+
+        // The previous approach of checking both ends of each line against every bounding box
+        std::vector<uint8_t> expectedResults(houghLines.size());
+
+        const double EXPECTED_ELAPSED_TIME = TimePerFrame([&]() {
+            for (std::size_t lineIndex = 0; lineIndex < houghLines.size(); lineIndex++)
+            {
+                const cv::Vec4i& HOUGH_LINE = houghLines[lineIndex];
+                expectedResults[lineIndex] = 0;
+
+                for (const ObjectDetectionInformation::DetectedObjectInformation& detectedObjectInformation : objectDetectionInformation.m_objectInformation)
+                {
+                    const cv::Point TOP_LEFT = FRAME_GEOMETRY.ToReference(detectedObjectInformation.m_boundingBox.tl());
+                    const cv::Point BOTTOM_RIGHT = FRAME_GEOMETRY.ToReference(detectedObjectInformation.m_boundingBox.br());
+
+                    if ((HOUGH_LINE[Globals::G_VEC4_X1_INDEX] >= TOP_LEFT.x && HOUGH_LINE[Globals::G_VEC4_X1_INDEX] <= BOTTOM_RIGHT.x &&
+                         HOUGH_LINE[Globals::G_VEC4_Y1_INDEX] >= TOP_LEFT.y && HOUGH_LINE[Globals::G_VEC4_Y1_INDEX] <= BOTTOM_RIGHT.y) ||
+                        (HOUGH_LINE[Globals::G_VEC4_X2_INDEX] >= TOP_LEFT.x && HOUGH_LINE[Globals::G_VEC4_X2_INDEX] <= BOTTOM_RIGHT.x &&
+                         HOUGH_LINE[Globals::G_VEC4_Y2_INDEX] >= TOP_LEFT.y && HOUGH_LINE[Globals::G_VEC4_Y2_INDEX] <= BOTTOM_RIGHT.y))
+                    {
+                        expectedResults[lineIndex] = 1;
+                        break;
+                    }
+                }
+            }
+        });
+
+        ObjectOccupancyMask objectOccupancyMask;
+        objectOccupancyMask.SetRegion(ROI_BOUNDING_BOX);
+
+        std::vector<uint8_t> actualResults(houghLines.size());
+
+        // The mask is updated every iteration, as it is every frame, so that its cost is included
+        const double ACTUAL_ELAPSED_TIME = TimePerFrame([&]() {
+            objectOccupancyMask.Update(objectDetectionInformation, FRAME_GEOMETRY);
+
+            for (std::size_t lineIndex = 0; lineIndex < houghLines.size(); lineIndex++)
+            {
+                const cv::Vec4i& HOUGH_LINE = houghLines[lineIndex];
+
+                actualResults[lineIndex] = static_cast<uint8_t>(objectOccupancyMask.IsOccupied(cv::Point(HOUGH_LINE[Globals::G_VEC4_X1_INDEX], HOUGH_LINE[Globals::G_VEC4_Y1_INDEX])) ||
+                                                                objectOccupancyMask.IsOccupied(cv::Point(HOUGH_LINE[Globals::G_VEC4_X2_INDEX], HOUGH_LINE[Globals::G_VEC4_Y2_INDEX])));
+            }
+        });
+
+        ReportComparison("Checking every bounding box",
+                         EXPECTED_ELAPSED_TIME,
+                         "the occupancy mask",
+                         ACTUAL_ELAPSED_TIME,
+                         std::format("with {} of {} lines within a bounding box", std::count(actualResults.begin(), actualResults.end(), 1), houghLines.size()),
+                         expectedResults == actualResults,
+                         "The object occupancy mask does not match checking every bounding box");
+    }
+
+    void PerformanceTests::RunHoughLineClassifierTest()
+    {
+        std::cout << "\n\n    ######## Lane Detector Hough Line Classifier ########\n";
+
+        const cv::Rect ROI_BOUNDING_BOX = cv::Rect(Globals::G_ROI_BOUNDING_BOX_ORIGIN, Globals::G_ROI_BOUNDING_BOX_SIZE);
+        const FrameGeometry FRAME_GEOMETRY(cv::Size(Globals::G_VIDEO_INPUT_WIDTH, Globals::G_VIDEO_INPUT_HEIGHT));
+
+        cv::RNG randomNumberGenerator(Globals::G_PERFORMANCE_TESTS_RANDOM_SEED);
+        std::vector<cv::Vec4i> houghLines;
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_LINE_CLASSIFIER_NUMBER_OF_LINES; i++)
+        {
+            const int32_t X1 = randomNumberGenerator.uniform(ROI_BOUNDING_BOX.x, ROI_BOUNDING_BOX.br().x);
+            const int32_t Y1 = randomNumberGenerator.uniform(ROI_BOUNDING_BOX.y, ROI_BOUNDING_BOX.br().y);
+            const int32_t X2 = (i % Globals::G_PERFORMANCE_TESTS_LINE_CLASSIFIER_VERTICAL_LINE_INTERVAL) == 0 ? X1 : randomNumberGenerator.uniform(ROI_BOUNDING_BOX.x, ROI_BOUNDING_BOX.br().x);
+            const int32_t Y2 = randomNumberGenerator.uniform(ROI_BOUNDING_BOX.y, ROI_BOUNDING_BOX.br().y);
+
+            houghLines.emplace_back(X1, Y1, X2, Y2);
+        }
+
+        // A vehicle ahead in the middle of the lane
+        ObjectDetectionInformation objectDetectionInformation;
+        objectDetectionInformation.m_objectInformation.push_back({.m_boundingBox = cv::Rect(ROI_BOUNDING_BOX.x + (ROI_BOUNDING_BOX.width / 3), ROI_BOUNDING_BOX.y, ROI_BOUNDING_BOX.width / 3, ROI_BOUNDING_BOX.height / 2),
+                                                                  .m_boundingBoxColour = Globals::G_COLOUR_WHITE,
+                                                                  .m_classId = 0,
+                                                                  .m_confidence = 1});
+
+        ObjectOccupancyMask objectOccupancyMask;
+        objectOccupancyMask.SetRegion(ROI_BOUNDING_BOX);
+        objectOccupancyMask.Update(objectDetectionInformation, FRAME_GEOMETRY);
+
+        // The previous approach of classifying one line at a time in double precision
+        const auto CLASSIFY_LINE = [&objectOccupancyMask](const cv::Vec4i& p_houghLine) {
+            const double CHANGE_IN_X = p_houghLine[Globals::G_VEC4_X1_INDEX] - p_houghLine[Globals::G_VEC4_X2_INDEX];
+            const double CHANGE_IN_Y = p_houghLine[Globals::G_VEC4_Y1_INDEX] - p_houghLine[Globals::G_VEC4_Y2_INDEX];
+
+            if (CHANGE_IN_X == 0)
+            {
+                return Globals::HoughLineTypes::VERTICAL;
+            }
+
+            const double GRADIENT = CHANGE_IN_Y / CHANGE_IN_X;
+
+            if (std::fabs(GRADIENT) < Globals::G_HOUGH_LINE_HORIZONTAL_GRADIENT_THRESHOLD)
+            {
+                return Globals::HoughLineTypes::HORIZONTAL;
+            }
+
+            if (objectOccupancyMask.IsOccupied(cv::Point(p_houghLine[Globals::G_VEC4_X1_INDEX], p_houghLine[Globals::G_VEC4_Y1_INDEX])) ||
+                objectOccupancyMask.IsOccupied(cv::Point(p_houghLine[Globals::G_VEC4_X2_INDEX], p_houghLine[Globals::G_VEC4_Y2_INDEX])))
+            {
+                return Globals::HoughLineTypes::WITHIN_OBJECT;
+            }
+
+            const auto IS_BELOW = [&p_houghLine](const double& p_m, const double& p_c, const double& p_buffer) {
+                return p_houghLine[Globals::G_VEC4_Y1_INDEX] < (p_m * p_houghLine[Globals::G_VEC4_X1_INDEX]) + p_c + p_buffer &&
+                       p_houghLine[Globals::G_VEC4_Y2_INDEX] < (p_m * p_houghLine[Globals::G_VEC4_X2_INDEX]) + p_c + p_buffer;
+            };
+
+            const auto IS_ON_OR_BELOW = [&p_houghLine](const double& p_m, const double& p_c, const double& p_buffer) {
+                return p_houghLine[Globals::G_VEC4_Y1_INDEX] <= (p_m * p_houghLine[Globals::G_VEC4_X1_INDEX]) + p_c + p_buffer &&
+                       p_houghLine[Globals::G_VEC4_Y2_INDEX] <= (p_m * p_houghLine[Globals::G_VEC4_X2_INDEX]) + p_c + p_buffer;
+            };
+
+            if (IS_ON_OR_BELOW(Globals::G_LEFT_EDGE_OF_MASK_M, Globals::G_LEFT_EDGE_OF_MASK_C, 1))
+            {
+                return Globals::HoughLineTypes::LEFT_EDGE;
+            }
+
+            if (IS_BELOW(Globals::G_LEFT_LINE_THRESHOLD_M, Globals::G_LEFT_LINE_THRESHOLD_C, 0) && GRADIENT < 0)
+            {
+                return Globals::HoughLineTypes::LEFT;
+            }
+
+            if (IS_ON_OR_BELOW(Globals::G_RIGHT_EDGE_OF_MASK_M, Globals::G_RIGHT_EDGE_OF_MASK_C, 1))
+            {
+                return Globals::HoughLineTypes::RIGHT_EDGE;
+            }
+
+            if (IS_BELOW(Globals::G_RIGHT_LINE_THRESHOLD_M, Globals::G_RIGHT_LINE_THRESHOLD_C, 0) && GRADIENT > 0)
+            {
+                return Globals::HoughLineTypes::RIGHT;
+            }
+
+            return Globals::HoughLineTypes::MIDDLE;
+        };
+
+        std::vector<Globals::HoughLineTypes> expectedLineTypes(houghLines.size());
+
+        const double EXPECTED_ELAPSED_TIME = TimePerFrame([&]() {
+            for (std::size_t lineIndex = 0; lineIndex < houghLines.size(); lineIndex++)
+            {
+                expectedLineTypes[lineIndex] = CLASSIFY_LINE(houghLines[lineIndex]);
+            }
+        });
+
+        HoughLineClassifier houghLineClassifier;
+
+        const double ACTUAL_ELAPSED_TIME = TimePerFrame([&]() {
+            houghLineClassifier.Run(houghLines, objectOccupancyMask);
+        });
+
+        const std::vector<Globals::HoughLineTypes>& ACTUAL_LINE_TYPES = houghLineClassifier.GetLineTypes();
+        std::size_t numberOfDifferences = 0;
+
+        for (std::size_t lineIndex = 0; lineIndex < houghLines.size(); lineIndex++)
+        {
+            if (expectedLineTypes[lineIndex] != ACTUAL_LINE_TYPES[lineIndex])
+            {
+                numberOfDifferences++;
+            }
+        }
+
+        ReportComparison("Classifying one line at a time",
+                         EXPECTED_ELAPSED_TIME,
+                         "the vectorised classifier",
+                         ACTUAL_ELAPSED_TIME,
+                         std::format("with {} of {} lines classified differently", numberOfDifferences, houghLines.size()),
+                         numberOfDifferences == 0,
+                         "The vectorised hough line classifier does not match classifying one line at a time");
+    }
+
+    void PerformanceTests::RunStripedCannyTest()
+    {
+        std::cout << "\n\n    ######## Lane Detector Striped Canny ########\n";
+
+        std::vector<cv::Range> roiRowSpans;
+        ImageKernels::ComputeTrapezoidRowSpans(Globals::G_ROI_MASK_POINTS, cv::Rect(Globals::G_ROI_BOUNDING_BOX_ORIGIN, Globals::G_ROI_BOUNDING_BOX_SIZE), roiRowSpans);
+
+        const cv::Mat FRAME = CreateSyntheticRoadFrame();
+        cv::Mat roiFrame;
+        ImageKernels::ConvertMaskedBgrToGrey(FRAME(Globals::G_ROI_BOUNDING_BOX_Y_RANGE, Globals::G_ROI_BOUNDING_BOX_X_RANGE), roiRowSpans, roiFrame);
+
+        cv::Mat expectedCannyFrame;
+
+        const double EXPECTED_ELAPSED_TIME = TimePerFrame([&]() {
+            cv::Canny(roiFrame, expectedCannyFrame, Globals::G_CANNY_ALGORITHM_LOWER_THRESHOLD, Globals::G_CANNY_ALGORITHM_UPPER_THRESHOLD);
+        });
+
+        // Always use several stripes, even on a single thread, so that the stripe boundaries are tested
+        const int32_t NUMBER_OF_STRIPES = std::max(cv::getNumThreads(), Globals::G_PERFORMANCE_TESTS_STRIPED_CANNY_NUMBER_OF_STRIPES);
+        std::vector<cv::Mat> cannyStripes;
+        cv::Mat actualCannyFrame;
+
+        const double ACTUAL_ELAPSED_TIME = TimePerFrame([&]() {
+            ImageKernels::RunStripedCanny(roiFrame, actualCannyFrame, Globals::G_CANNY_ALGORITHM_LOWER_THRESHOLD, Globals::G_CANNY_ALGORITHM_UPPER_THRESHOLD, NUMBER_OF_STRIPES, cannyStripes);
+        });
+
+        std::vector<cv::Vec4i> expectedHoughLines;
+        std::vector<cv::Vec4i> actualHoughLines;
+        cv::HoughLinesP(expectedCannyFrame, expectedHoughLines, Globals::G_HOUGH_RHO, Globals::G_HOUGH_THETA, Globals::G_HOUGH_THRESHOLD, Globals::G_HOUGH_MIN_LINE_LENGTH, Globals::G_HOUGH_MAX_LINE_GAP);
+        cv::HoughLinesP(actualCannyFrame, actualHoughLines, Globals::G_HOUGH_RHO, Globals::G_HOUGH_THETA, Globals::G_HOUGH_THRESHOLD, Globals::G_HOUGH_MIN_LINE_LENGTH, Globals::G_HOUGH_MAX_LINE_GAP);
+
+        // Get the proportion of the lines in the first set which have a line in the second set with the same endpoints, in
+        // either order, within the tolerance
+        const auto MATCHED_PROPORTION = [](const std::vector<cv::Vec4i>& p_houghLines, const std::vector<cv::Vec4i>& p_otherHoughLines) {
+            if (p_houghLines.empty())
+            {
+                return p_otherHoughLines.empty() ? 1.0 : 0.0;
+            }
+
+            uint32_t numberOfMatchedLines = 0;
+
+            for (const cv::Vec4i& houghLine : p_houghLines)
+            {
+                const cv::Point POINT_ONE = cv::Point(houghLine[Globals::G_VEC4_X1_INDEX], houghLine[Globals::G_VEC4_Y1_INDEX]);
+                const cv::Point POINT_TWO = cv::Point(houghLine[Globals::G_VEC4_X2_INDEX], houghLine[Globals::G_VEC4_Y2_INDEX]);
+
+                for (const cv::Vec4i& otherHoughLine : p_otherHoughLines)
+                {
+                    const cv::Point OTHER_POINT_ONE = cv::Point(otherHoughLine[Globals::G_VEC4_X1_INDEX], otherHoughLine[Globals::G_VEC4_Y1_INDEX]);
+                    const cv::Point OTHER_POINT_TWO = cv::Point(otherHoughLine[Globals::G_VEC4_X2_INDEX], otherHoughLine[Globals::G_VEC4_Y2_INDEX]);
+
+                    const bool SAME_ORDER = cv::norm(POINT_ONE - OTHER_POINT_ONE) <= Globals::G_PERFORMANCE_TESTS_HOUGH_LINE_ENDPOINT_TOLERANCE &&
+                                            cv::norm(POINT_TWO - OTHER_POINT_TWO) <= Globals::G_PERFORMANCE_TESTS_HOUGH_LINE_ENDPOINT_TOLERANCE;
+                    const bool REVERSE_ORDER = cv::norm(POINT_ONE - OTHER_POINT_TWO) <= Globals::G_PERFORMANCE_TESTS_HOUGH_LINE_ENDPOINT_TOLERANCE &&
+                                               cv::norm(POINT_TWO - OTHER_POINT_ONE) <= Globals::G_PERFORMANCE_TESTS_HOUGH_LINE_ENDPOINT_TOLERANCE;
+
+                    if (SAME_ORDER || REVERSE_ORDER)
+                    {
+                        numberOfMatchedLines++;
+                        break;
+                    }
+                }
+            }
+
+            return static_cast<double>(numberOfMatchedLines) / static_cast<double>(p_houghLines.size());
+        };
+
+        const double EXPECTED_MATCHED_PROPORTION = MATCHED_PROPORTION(expectedHoughLines, actualHoughLines);
+        const double ACTUAL_MATCHED_PROPORTION = MATCHED_PROPORTION(actualHoughLines, expectedHoughLines);
+
+        ReportComparison("cv::Canny",
+                         EXPECTED_ELAPSED_TIME,
+                         std::format("{} stripes", NUMBER_OF_STRIPES),
+                         ACTUAL_ELAPSED_TIME,
+                         std::format("with {:.1f}% of {} and {:.1f}% of {} hough lines matched", EXPECTED_MATCHED_PROPORTION * 100, expectedHoughLines.size(), ACTUAL_MATCHED_PROPORTION * 100, actualHoughLines.size()),
+                         EXPECTED_MATCHED_PROPORTION >= Globals::G_PERFORMANCE_TESTS_HOUGH_LINE_MINIMUM_MATCHED_PROPORTION && ACTUAL_MATCHED_PROPORTION >= Globals::G_PERFORMANCE_TESTS_HOUGH_LINE_MINIMUM_MATCHED_PROPORTION,
+                         "The hough lines found using the striped Canny algorithm do not match those found using cv::Canny");
+    }
+
+    void PerformanceTests::RunLetterboxTest()
+    {
+        std::cout << "\n\n    ######## Object Detector Letterbox ########\n";
+
+        cv::Mat frame(Globals::G_VIDEO_INPUT_HEIGHT, Globals::G_VIDEO_INPUT_WIDTH, CV_8UC3);
+        cv::RNG randomNumberGenerator(Globals::G_PERFORMANCE_TESTS_RANDOM_SEED);
+        randomNumberGenerator.fill(frame, cv::RNG::UNIFORM, 0, UINT8_MAX + 1);
+
+        const int32_t BLOB_SIZE = static_cast<int32_t>(Globals::G_PERFORMANCE_TESTS_LETTERBOX_BLOB_SIZE);
+
+        // The previous approach of squashing the frame in to the blob
+        cv::Mat squashedBlob;
+
+        const double SQUASHED_ELAPSED_TIME = TimePerFrame([&]() {
+            cv::dnn::blobFromImage(frame, squashedBlob, Globals::G_OBJECT_DETECTOR_SCALE_FACTOR, cv::Size(BLOB_SIZE, BLOB_SIZE), Globals::G_COLOUR_BLACK, true);
+        });
+
+        LetterboxPreprocessor letterboxPreprocessor;
+
+        const double LETTERBOX_ELAPSED_TIME = TimePerFrame([&]() {
+            letterboxPreprocessor.Run(frame, BLOB_SIZE);
+        });
+
+        // The letterbox must match the resized frame converted by cv::dnn::blobFromImage, and everything else must be padding
+        const cv::Rect LETTERBOX = letterboxPreprocessor.GetLetterbox();
+        const cv::Mat& ACTUAL_BLOB = letterboxPreprocessor.GetBlob();
+
+        cv::Mat resizedFrame;
+        cv::resize(frame, resizedFrame, LETTERBOX.size(), 0, 0, cv::INTER_LINEAR);
+        const cv::Mat EXPECTED_BLOB = cv::dnn::blobFromImage(resizedFrame, Globals::G_OBJECT_DETECTOR_SCALE_FACTOR, cv::Size(), Globals::G_COLOUR_BLACK, true);
+
+        double maximumDifference = 0;
+
+        for (int32_t channel = 0; channel < 3; channel++)
+        {
+            const cv::Mat ACTUAL_PLANE = cv::Mat(BLOB_SIZE, BLOB_SIZE, CV_32F, const_cast<float*>(ACTUAL_BLOB.ptr<float>(0, channel))); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            const cv::Mat EXPECTED_PLANE = cv::Mat(LETTERBOX.height, LETTERBOX.width, CV_32F, const_cast<float*>(EXPECTED_BLOB.ptr<float>(0, channel))); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+
+            maximumDifference = std::max(maximumDifference, cv::norm(ACTUAL_PLANE(LETTERBOX), EXPECTED_PLANE, cv::NORM_INF));
+
+            cv::Mat paddingMask = cv::Mat::ones(BLOB_SIZE, BLOB_SIZE, CV_8UC1);
+            paddingMask(LETTERBOX).setTo(cv::Scalar::all(0));
+            cv::Mat paddingDifference;
+            cv::absdiff(ACTUAL_PLANE, cv::Scalar::all(Globals::G_OBJECT_DETECTOR_LETTERBOX_PADDING), paddingDifference);
+
+            maximumDifference = std::max(maximumDifference, cv::norm(paddingDifference, cv::NORM_INF, paddingMask));
+        }
+
+        ReportComparison("Squashing with cv::dnn::blobFromImage",
+                         SQUASHED_ELAPSED_TIME,
+                         "letterboxing",
+                         LETTERBOX_ELAPSED_TIME,
+                         std::format("with a maximum difference of {}", maximumDifference),
+                         maximumDifference <= Globals::G_PERFORMANCE_TESTS_LETTERBOX_TOLERANCE,
+                         "The letterboxed blob does not match cv::dnn::blobFromImage");
+    }
+
+    void PerformanceTests::RunObjectTrackerTest()
+    {
+        std::cout << "\n\n    ######## Object Detector Tracker ########\n";
+
+        ObjectTracker objectTracker;
+        ObjectDetectionInformation objectDetectionInformation;
+        double minimumIntersectionOverUnion = 1;
+
+        for (uint32_t frameNumber = 0; frameNumber < Globals::G_PERFORMANCE_TESTS_OBJECT_TRACKER_NUMBER_OF_FRAMES; frameNumber++)
+        {
+            const cv::Rect EXPECTED_BOUNDING_BOX = Globals::G_PERFORMANCE_TESTS_OBJECT_TRACKER_INITIAL_BOUNDING_BOX + (Globals::G_PERFORMANCE_TESTS_OBJECT_TRACKER_VELOCITY * static_cast<int32_t>(frameNumber));
+
+            if (frameNumber % Globals::G_PERFORMANCE_TESTS_OBJECT_TRACKER_INTERVAL == 0)
+            {
+                objectDetectionInformation.m_objectInformation = {
+                    {.m_boundingBox = EXPECTED_BOUNDING_BOX, .m_boundingBoxColour = Globals::G_COLOUR_BLACK, .m_classId = 0, .m_confidence = 1}
+                };
+                objectTracker.Update(objectDetectionInformation);
+                continue;
+            }
+
+            objectTracker.Predict(objectDetectionInformation);
+
+            if (objectDetectionInformation.m_objectInformation.size() != 1)
+            {
+                std::cout << "\nERROR: The object tracker lost the synthetic object!\n";
+                throw Globals::Exceptions::PerformanceTestError();
+            }
+
+            if (frameNumber >= Globals::G_PERFORMANCE_TESTS_OBJECT_TRACKER_WARM_UP_FRAMES)
+            {
+                const cv::Rect ACTUAL_BOUNDING_BOX = objectDetectionInformation.m_objectInformation.front().m_boundingBox;
+                const double INTERSECTION_AREA = (ACTUAL_BOUNDING_BOX & EXPECTED_BOUNDING_BOX).area();
+                const double UNION_AREA = static_cast<double>(ACTUAL_BOUNDING_BOX.area()) + EXPECTED_BOUNDING_BOX.area() - INTERSECTION_AREA;
+
+                minimumIntersectionOverUnion = std::min(minimumIntersectionOverUnion, INTERSECTION_AREA / UNION_AREA);
+            }
+        }
+
+        std::cout << std::format("\n        Minimum intersection-over-union of the predicted and actual bounding boxes: {:.3f}", minimumIntersectionOverUnion);
+
+        if (minimumIntersectionOverUnion < Globals::G_PERFORMANCE_TESTS_OBJECT_TRACKER_MINIMUM_IOU)
+        {
+            std::cout << "\nERROR: The object tracker does not follow an object moving at a constant velocity!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+    }
+
+    void PerformanceTests::RunQualityControllerTest()
+    {
+        std::cout << "\n\n    ######## Object Detector Quality Controller ########\n";
+
+        QualityController qualityController;
+        qualityController.SetTargetFramesPerSecond(Globals::G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_TARGET_FPS);
+        qualityController.SetStartingLevel(Globals::ObjectDetectorTypes::STANDARD, Globals::ObjectDetectorBlobSizes::FIVE);
+
+        uint32_t numberOfLevelChanges = 0;
+        bool qualityRaised = false;
+
+        for (uint32_t frameNumber = 0; frameNumber < Globals::G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_NUMBER_OF_FRAMES; frameNumber++)
+        {
+            qualityController.Update((qualityController.GetLevel() + 1) * Globals::G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_LEVEL_FRAME_TIME);
+
+            // Switch as soon as a level is requested, as if its network had been preloaded
+            if (qualityController.GetRequestedLevel() != qualityController.GetLevel())
+            {
+                qualityRaised = qualityRaised || qualityController.GetRequestedLevel() > qualityController.GetLevel();
+                qualityController.SetLevel(qualityController.GetRequestedLevel());
+                numberOfLevelChanges++;
+            }
+        }
+
+        std::cout << std::format("\n        Final quality level: {} after {} level changes", qualityController.GetLevel(), numberOfLevelChanges);
+
+        if (qualityController.GetLevel() != Globals::G_PERFORMANCE_TESTS_QUALITY_CONTROLLER_EXPECTED_LEVEL || qualityRaised)
+        {
+            std::cout << "\nERROR: The quality controller did not settle on the highest quality level within the budget!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+    }
+
+    void PerformanceTests::RunQuantisationDriftTest()
+    {
+        std::cout << "\n\n    ######## Object Detector Quantisation Drift ########\n";
+
+        const std::vector<cv::Mat> FRAMES = ReadBenchmarkFrames(Globals::G_PERFORMANCE_TESTS_QUANTISATION_NUMBER_OF_FRAMES);
+
+        ObjectDetector objectDetector;
+
+        // Runs the object detector with the given backend on every frame, returning the average time per frame
+        const auto RUN_OBJECT_DETECTOR = [&](const Globals::ObjectDetectorBackEnds& p_objectDetectorBackEnd, std::vector<std::vector<ObjectDetectionInformation::DetectedObjectInformation>>& p_detectedObjects) {
+            objectDetector.SetProperties(m_yoloFolderPath, Globals::G_PERFORMANCE_TESTS_QUANTISATION_OBJECT_DETECTOR_TYPE, p_objectDetectorBackEnd, Globals::G_PERFORMANCE_TESTS_QUANTISATION_BLOB_SIZE);
+            p_detectedObjects.resize(FRAMES.size());
+
+            const std::chrono::time_point<std::chrono::high_resolution_clock> START_TIME = std::chrono::high_resolution_clock::now();
+
+            for (uint32_t i = 0; i < FRAMES.size(); i++)
+            {
+                objectDetector.RunObjectDetector(FRAMES[i]);
+                p_detectedObjects[i] = objectDetector.GetInformation().m_objectInformation;
+            }
+
+            const double ELAPSED_TIME = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - START_TIME).count();
+
+            return ELAPSED_TIME / static_cast<double>(std::max<std::size_t>(FRAMES.size(), 1));
+        };
+
+        std::vector<std::vector<ObjectDetectionInformation::DetectedObjectInformation>> expectedDetectedObjects;
+        const double EXPECTED_TIME = RUN_OBJECT_DETECTOR(Globals::ObjectDetectorBackEnds::CPU, expectedDetectedObjects);
+
+        std::cout << std::format("\n        CPU took {:.2f} {} per frame over {} frames", EXPECTED_TIME, Globals::G_TIME_UNIT, FRAMES.size());
+
+        bool driftExceeded = false;
+
+        for (const Globals::ObjectDetectorBackEnds& objectDetectorBackEnd : Globals::G_PERFORMANCE_TESTS_QUANTISATION_BACK_ENDS)
+        {
+            if (objectDetectorBackEnd == Globals::ObjectDetectorBackEnds::CPU_INT8 && !NetworkCache::HasCalibrationFrames(m_yoloFolderPath))
+            {
+                std::cout << "\n        CPU INT8 skipped as the YOLO folder does not contain any calibration frames";
+                continue;
+            }
+
+            std::vector<std::vector<ObjectDetectionInformation::DetectedObjectInformation>> actualDetectedObjects;
+            const double ACTUAL_TIME = RUN_OBJECT_DETECTOR(objectDetectorBackEnd, actualDetectedObjects);
+
+            uint32_t numberOfExpectedObjects = 0;
+            uint32_t numberOfActualObjects = 0;
+            uint32_t numberOfMatchedObjects = 0;
+
+            for (uint32_t i = 0; i < FRAMES.size(); i++)
+            {
+                std::vector<bool> matched(actualDetectedObjects[i].size(), false);
+
+                // Greedily match each FP32 detection to the best overlapping unmatched detection of the same class
+                for (const ObjectDetectionInformation::DetectedObjectInformation& expectedObject : expectedDetectedObjects[i])
+                {
+                    double bestIntersectionOverUnion = Globals::G_PERFORMANCE_TESTS_QUANTISATION_MINIMUM_IOU;
+                    std::size_t bestIndex = actualDetectedObjects[i].size();
+
+                    for (std::size_t j = 0; j < actualDetectedObjects[i].size(); j++)
+                    {
+                        const ObjectDetectionInformation::DetectedObjectInformation& ACTUAL_OBJECT = actualDetectedObjects[i][j];
+
+                        if (matched[j] || ACTUAL_OBJECT.m_classId != expectedObject.m_classId)
+                        {
+                            continue;
+                        }
+
+                        const double INTERSECTION_AREA = (ACTUAL_OBJECT.m_boundingBox & expectedObject.m_boundingBox).area();
+                        const double UNION_AREA = static_cast<double>(ACTUAL_OBJECT.m_boundingBox.area()) + expectedObject.m_boundingBox.area() - INTERSECTION_AREA;
+
+                        if (UNION_AREA > 0 && INTERSECTION_AREA / UNION_AREA >= bestIntersectionOverUnion)
+                        {
+                            bestIntersectionOverUnion = INTERSECTION_AREA / UNION_AREA;
+                            bestIndex = j;
+                        }
+                    }
+
+                    if (bestIndex != actualDetectedObjects[i].size())
+                    {
+                        matched[bestIndex] = true;
+                        numberOfMatchedObjects++;
+                    }
+                }
+
+                numberOfExpectedObjects += static_cast<uint32_t>(expectedDetectedObjects[i].size());
+                numberOfActualObjects += static_cast<uint32_t>(actualDetectedObjects[i].size());
+            }
+
+            const double EXPECTED_MATCHED_PROPORTION = numberOfExpectedObjects == 0 ? 1 : numberOfMatchedObjects / static_cast<double>(numberOfExpectedObjects);
+            const double ACTUAL_MATCHED_PROPORTION = numberOfActualObjects == 0 ? 1 : numberOfMatchedObjects / static_cast<double>(numberOfActualObjects);
+
+            std::cout << std::format("\n        {} took {:.2f} {} per frame ({:.2f}x) and matched {:.3f} of the CPU detections with {:.3f} of its detections matched",
+                                     objectDetectorBackEnd == Globals::ObjectDetectorBackEnds::CPU_FP16 ? "CPU FP16" : "CPU INT8",
+                                     ACTUAL_TIME,
+                                     Globals::G_TIME_UNIT,
+                                     ACTUAL_TIME > 0 ? EXPECTED_TIME / ACTUAL_TIME : 0,
+                                     EXPECTED_MATCHED_PROPORTION,
+                                     ACTUAL_MATCHED_PROPORTION);
+
+            driftExceeded = driftExceeded || EXPECTED_MATCHED_PROPORTION < Globals::G_PERFORMANCE_TESTS_QUANTISATION_MINIMUM_MATCHED_PROPORTION ||
+                            ACTUAL_MATCHED_PROPORTION < Globals::G_PERFORMANCE_TESTS_QUANTISATION_MINIMUM_MATCHED_PROPORTION;
+        }
+
+        if (driftExceeded)
+        {
+            std::cout << "\nERROR: The detections of a quantised CPU backend have drifted too far from those of the FP32 CPU backend!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+    }
+
+    void PerformanceTests::RunHorizonCropTest()
+    {
+        std::cout << "\n\n    ######## Object Detector Horizon Crop ########\n";
+
+        const std::vector<cv::Mat> FRAMES = ReadBenchmarkFrames(Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_NUMBER_OF_FRAMES);
+
+        if (FRAMES.empty())
+        {
+            std::cout << "\nERROR: No frames could be read from the input video file!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+
+        ObjectDetector objectDetector;
+
+        // Runs the object detector on every frame, returning the average time per frame and the number of small objects found
+        const auto RUN_OBJECT_DETECTOR = [&](const Globals::ObjectDetectorBlobSizes& p_objectDetectorBlobSize, const bool& p_horizonCrop) {
+            objectDetector.SetProperties(m_yoloFolderPath, Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_OBJECT_DETECTOR_TYPE, Globals::ObjectDetectorBackEnds::CPU, p_objectDetectorBlobSize);
+            objectDetector.SetHorizonCrop(p_horizonCrop);
+
+            // The first forward pass after loading the network is not representative, so it is left out of the timing
+            objectDetector.RunObjectDetector(FRAMES.front());
+
+            uint32_t numberOfSmallObjects = 0;
+            const std::chrono::time_point<std::chrono::high_resolution_clock> START_TIME = std::chrono::high_resolution_clock::now();
+
+            for (const cv::Mat& frame : FRAMES)
+            {
+                objectDetector.RunObjectDetector(frame);
+
+                // The area is scaled to the reference resolution so that the same objects count as small at any resolution
+                const double AREA_SCALE = (static_cast<double>(Globals::G_VIDEO_INPUT_WIDTH) * Globals::G_VIDEO_INPUT_HEIGHT) / frame.total();
+
+                for (const ObjectDetectionInformation::DetectedObjectInformation& detectedObject : objectDetector.GetInformation().m_objectInformation)
+                {
+                    if (detectedObject.m_boundingBox.area() * AREA_SCALE < Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_SMALL_OBJECT_AREA)
+                    {
+                        numberOfSmallObjects++;
+                    }
+                }
+            }
+
+            const double ELAPSED_TIME = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - START_TIME).count();
+
+            return std::make_pair(ELAPSED_TIME / static_cast<double>(FRAMES.size()), numberOfSmallObjects);
+        };
+
+        const std::pair<double, uint32_t> FULL_FRAME = RUN_OBJECT_DETECTOR(Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_BLOB_SIZE, false);
+        const std::pair<double, uint32_t> HORIZON_CROP = RUN_OBJECT_DETECTOR(Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_BLOB_SIZE, true);
+        const std::pair<double, uint32_t> REFERENCE = RUN_OBJECT_DETECTOR(Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_REFERENCE_BLOB_SIZE, false);
+
+        std::cout << std::format("\n        Blob size {} found {} small objects in {:.2f} {} per frame",
+                                 static_cast<int32_t>(Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_BLOB_SIZE),
+                                 FULL_FRAME.second,
+                                 FULL_FRAME.first,
+                                 Globals::G_TIME_UNIT);
+        std::cout << std::format("\n        Blob size {} with the horizon crop found {} small objects in {:.2f} {} per frame",
+                                 static_cast<int32_t>(Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_BLOB_SIZE),
+                                 HORIZON_CROP.second,
+                                 HORIZON_CROP.first,
+                                 Globals::G_TIME_UNIT);
+        std::cout << std::format("\n        Blob size {} found {} small objects in {:.2f} {} per frame",
+                                 static_cast<int32_t>(Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_REFERENCE_BLOB_SIZE),
+                                 REFERENCE.second,
+                                 REFERENCE.first,
+                                 Globals::G_TIME_UNIT);
+
+        if (HORIZON_CROP.second < FULL_FRAME.second)
+        {
+            std::cout << "\nERROR: The horizon crop found fewer small objects than the full frame alone!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+
+        if (HORIZON_CROP.second < Globals::G_PERFORMANCE_TESTS_HORIZON_CROP_MINIMUM_REFERENCE_PROPORTION * REFERENCE.second)
+        {
+            std::cout << "\nERROR: The horizon crop found too few of the small objects found at the largest blob size!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+
+        if (HORIZON_CROP.first >= REFERENCE.first)
+        {
+            std::cout << "\nERROR: The two passes of the horizon crop took longer than a single pass at the largest blob size!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+    }
+
+    std::vector<cv::Mat> PerformanceTests::ReadBenchmarkFrames(const uint32_t& p_numberOfFrames)
+    {
+        cv::VideoCapture videoCapture;
+
+        if (!videoCapture.open(m_inputVideoFilePath))
+        {
+            std::cout << "\nERROR: Input video file path '" + m_inputVideoFilePath + "' cannot be found!\n";
+            std::exit(1);
+        }
+
+        std::vector<cv::Mat> frames;
+        cv::Mat frame;
+
+        while (frames.size() < p_numberOfFrames && videoCapture.read(frame))
+        {
+            frames.push_back(frame.clone());
+        }
+
+        return frames;
+    }
+
+    template<typename Function>
+    double PerformanceTests::TimePerFrame(const Function& p_function)
+    {
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_WARM_UP_ITERATIONS; i++)
+        {
+            p_function();
+        }
+
+        const std::chrono::time_point<std::chrono::high_resolution_clock> START_TIME = std::chrono::high_resolution_clock::now();
+
+        for (uint32_t i = 0; i < Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_ITERATIONS; i++)
+        {
+            p_function();
+        }
+
+        const double ELAPSED_TIME = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - START_TIME).count();
+
+        return ELAPSED_TIME / Globals::G_PERFORMANCE_TESTS_MICRO_BENCHMARK_ITERATIONS;
+    }
+
+    void PerformanceTests::ReportComparison(const std::string& p_expectedName,
+                                            const double& p_expectedElapsedTime,
+                                            const std::string& p_actualName,
+                                            const double& p_actualElapsedTime,
+                                            const std::string& p_results,
+                                            const bool& p_isMatching,
+                                            const std::string& p_errorMessage)
+    {
+        std::cout << std::format("\n        {} took {:.2f} {} and {} took {:.2f} {} per frame {}",
+                                 p_expectedName,
+                                 p_expectedElapsedTime,
+                                 Globals::G_TIME_UNIT,
+                                 p_actualName,
+                                 p_actualElapsedTime,
+                                 Globals::G_TIME_UNIT,
+                                 p_results);
+
+        if (!p_isMatching)
+        {
+            std::cout << "\nERROR: " + p_errorMessage + "!\n";
+            throw Globals::Exceptions::PerformanceTestError();
+        }
+    }
+
+    cv::Mat PerformanceTests::CreateSyntheticRoadFrame()
+    {
+        cv::Mat frame(Globals::G_VIDEO_INPUT_HEIGHT, Globals::G_VIDEO_INPUT_WIDTH, CV_8UC3);
+        cv::RNG randomNumberGenerator(Globals::G_PERFORMANCE_TESTS_RANDOM_SEED);
+        randomNumberGenerator.fill(frame, cv::RNG::UNIFORM, Globals::G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_MINIMUM_INTENSITY, Globals::G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_MAXIMUM_INTENSITY);
+
+        // Lane lines run parallel to the left and right edges of the region-of-interest, just inside of it
+        const cv::Point INSET = cv::Point(Globals::G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_LINE_INSET, 0);
+
+        cv::line(frame,
+                 Globals::G_ROI_MASK_POINTS[Globals::G_ROI_TOP_LEFT_INDEX] + INSET,
+                 Globals::G_ROI_MASK_POINTS[Globals::G_ROI_BOTTOM_LEFT_INDEX] + INSET,
+                 Globals::G_COLOUR_WHITE,
+                 Globals::G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_LINE_THICKNESS);
+        cv::line(frame,
+                 Globals::G_ROI_MASK_POINTS[Globals::G_ROI_TOP_RIGHT_INDEX] - INSET,
+                 Globals::G_ROI_MASK_POINTS[Globals::G_ROI_BOTTOM_RIGHT_INDEX] - INSET,
+                 Globals::G_COLOUR_WHITE,
+                 Globals::G_PERFORMANCE_TESTS_SYNTHETIC_ROAD_LINE_THICKNESS);
+
+        return frame;
+    }
+
     PerformanceTests::SQLiteDatabase::~SQLiteDatabase()
     {
         sqlite3_close(m_database);
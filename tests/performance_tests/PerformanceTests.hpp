@@ -2,6 +2,7 @@
 #include <string>
 #include <vector>
 
+#include <opencv2/core/mat.hpp>
 #include <sqlite3.h>
 
 #include "helpers/Globals.hpp"
@@ -27,13 +28,21 @@ namespace LaneAndObjectDetection
          * @param p_inputVideoFilePath The file path of the video file to use as the benchmark input.
          * @param p_yoloFolderPath The folder containing the `.cfg` and `.weights` YOLO files.
          * @param p_numberOfRepetitions The number of times to repeat each test.
+         * @param p_runChecks Whether to run the micro-benchmarks and checks instead of the video tests.
+         * @param p_includeQuantisedBackEnds Whether to also run the video tests on the quantised CPU backends.
          */
-        explicit PerformanceTests(std::string p_currentPlatform, std::string p_databasePath, std::string p_inputVideoFilePath, std::string p_yoloFolderPath, const uint32_t& p_numberOfRepetitions);
+        explicit PerformanceTests(std::string p_currentPlatform,
+                                  std::string p_databasePath,
+                                  std::string p_inputVideoFilePath,
+                                  std::string p_yoloFolderPath,
+                                  const uint32_t& p_numberOfRepetitions,
+                                  const bool& p_runChecks,
+                                  const bool& p_includeQuantisedBackEnds);
 
         /**
          * @brief Constructs a new %PerformanceTests object (for CLI use).
          *
-         * Usage: lane-and-object-detection-performance-tests --platform ... --database-path ... --input ... --yolo-folder-path ... --repetitions ...
+         * Usage: lane-and-object-detection-performance-tests --platform ... --database-path ... --input ... --yolo-folder-path ... --repetitions ... [optional]
          *
          * OPTIONS:
          *
@@ -49,16 +58,160 @@ namespace LaneAndObjectDetection
          * -y --yolo-folder-path  Path to the yolo configuration folder
          * -r --repetitions       Number of repetitions for each test
          *
+         * Optional Options:
+         *
+         * -c --checks            Run the micro-benchmarks and checks instead of the video tests (only --input and
+         *                        --yolo-folder-path are required)
+         * -q --quantised         Also run the video tests on the quantised CPU backends
+         *
          * @param p_commandLineArguments List of all command line arguments.
          */
         explicit PerformanceTests(const std::vector<std::string>& p_commandLineArguments);
 
         /**
-         * @brief Runs the performance tests against the input benchmark video file.
+         * @brief Runs the performance tests against the input benchmark video file, or the micro-benchmarks and checks if
+         * they were requested instead. The video tests only record frame times, so a failed check never stops the FPS
+         * database from being produced.
          */
         void RunPerformanceTests();
 
     private:
+        /**
+         * @brief Runs the micro-benchmarks against synthetic data and the checks against the start of the input benchmark
+         * video, stopping at the first failed check.
+         */
+        void RunChecks();
+
+        /**
+         * @brief Checks that the object detector post-processing makes no heap allocations once warmed up, by running it
+         * against synthetic output blobs while counting calls to the global `operator new`, and reports its average time. Then
+         * checks that running the whole object detector on a frame, while holding snapshots of its information as the
+         * pipeline does, makes no more heap allocations than the forward pass of the network alone.
+         */
+        void RunPostProcessingAllocationTest();
+
+        /**
+         * @brief Creates output blobs with the same shape as those of YOLOv7 where most rows are background and a detection
+         * is placed at a regular interval.
+         *
+         * @return `std::vector<cv::Mat>` The synthetic output blobs.
+         */
+        static std::vector<cv::Mat> CreateSyntheticOutputBlobs();
+
+        /**
+         * @brief Compares the non-maxima suppression used by the object detector against `cv::dnn::NMSBoxes` and
+         * `cv::dnn::NMSBoxesBatched` on a dense scene of synthetic candidates, checking that exactly the same candidates are
+         * kept, that limiting the number kept returns the highest confidence of them, and reporting the average time
+         * of each.
+         */
+        static void RunNonMaximaSuppressionBenchmark();
+
+        /**
+         * @brief Compares the fused masked grey conversion used by the lane detector against masking the frame and then
+         * calling `cv::cvtColor`, checking that the results match and reporting the average time of each.
+         */
+        static void RunGreyConversionBenchmark();
+
+        /**
+         * @brief Compares the object occupancy mask used by the lane detector against checking each line against every object
+         * bounding box, checking that the results are identical and reporting the average time of each.
+         */
+        static void RunObjectOccupancyMaskTest();
+
+        /**
+         * @brief Compares the vectorised hough line classifier used by the lane detector against classifying one line at a
+         * time in double precision, checking that every line type matches and reporting the average time of each.
+         */
+        static void RunHoughLineClassifierTest();
+
+        /**
+         * @brief Compares the hough lines found using the striped Canny algorithm used by the lane detector against those
+         * found using `cv::Canny`, checking that they match within a tolerance and reporting the average time of each.
+         */
+        static void RunStripedCannyTest();
+
+        /**
+         * @brief Compares the blob created by the letterbox preprocessor used by the object detector against resizing the
+         * frame and calling `cv::dnn::blobFromImage`, checking that the results and padding match and reporting the average
+         * time of the letterbox preprocessor and of squashing the frame with `cv::dnn::blobFromImage`.
+         */
+        static void RunLetterboxTest();
+
+        /**
+         * @brief Checks that the object tracker used between detections follows a synthetic object moving at a constant
+         * velocity.
+         */
+        static void RunObjectTrackerTest();
+
+        /**
+         * @brief Checks that the quality controller steps down to, and then holds, the highest quality level that fits the
+         * frame time budget when fed synthetic frame times.
+         */
+        static void RunQualityControllerTest();
+
+        /**
+         * @brief Runs the object detector with the FP32 CPU backend and each quantised CPU backend on the start of the input
+         * benchmark video, checking that the detections of the quantised backends match those of the FP32 backend within a
+         * tolerance and reporting the average time of each.
+         */
+        void RunQuantisationDriftTest();
+
+        /**
+         * @brief Runs the object detector on the start of the input benchmark video with and without the horizon crop, and at
+         * the largest blob size, checking that the horizon crop finds at least as many small objects as the full frame alone
+         * and most of those found at the largest blob size, that its two passes take less time than a single pass at the
+         * largest blob size, and reporting the average time and number of small objects found by each.
+         */
+        void RunHorizonCropTest();
+
+        /**
+         * @brief Reads frames from the start of the input benchmark video.
+         *
+         * @param p_numberOfFrames The maximum number of frames to read.
+         * @return `std::vector<cv::Mat>` The frames.
+         */
+        std::vector<cv::Mat> ReadBenchmarkFrames(const uint32_t& p_numberOfFrames);
+
+        /**
+         * @brief Runs `p_function` for the micro-benchmark warm-up iterations and then times it over the micro-benchmark
+         * iterations.
+         *
+         * @tparam Function The type of the callable being timed.
+         * @param p_function The callable being timed.
+         * @return `double` The average time of `p_function` in `Globals::G_TIME_UNIT`.
+         */
+        template<typename Function>
+        static double TimePerFrame(const Function& p_function);
+
+        /**
+         * @brief Reports the average time of a reference implementation and of the implementation compared against it, then
+         * raises PerformanceTestError if their results do not match.
+         *
+         * @param p_expectedName The name of the reference implementation.
+         * @param p_expectedElapsedTime The average time of the reference implementation in `Globals::G_TIME_UNIT`.
+         * @param p_actualName The name of the implementation compared against the reference.
+         * @param p_actualElapsedTime The average time of the implementation compared against the reference in
+         * `Globals::G_TIME_UNIT`.
+         * @param p_results A description of the results appended to the report.
+         * @param p_isMatching Whether the results match.
+         * @param p_errorMessage The error printed if the results do not match.
+         * @exception `PerformanceTestError` Raised when `p_isMatching` is false.
+         */
+        static void ReportComparison(const std::string& p_expectedName,
+                                     const double& p_expectedElapsedTime,
+                                     const std::string& p_actualName,
+                                     const double& p_actualElapsedTime,
+                                     const std::string& p_results,
+                                     const bool& p_isMatching,
+                                     const std::string& p_errorMessage);
+
+        /**
+         * @brief Creates a frame of a noisy road with a lane line either side of the region-of-interest.
+         *
+         * @return `cv::Mat` The synthetic road frame.
+         */
+        static cv::Mat CreateSyntheticRoadFrame();
+
         /**
          * @class SQLiteDatabase
          * @brief SQLite wrapper class. This class is in the private scope as the implementation is PerformanceTests-specific.
@@ -187,5 +340,15 @@ namespace LaneAndObjectDetection
          * @brief The number of times to repeat each test.
          */
         uint32_t m_numberOfRepetitions;
+
+        /**
+         * @brief Whether to run the micro-benchmarks and checks instead of the video tests.
+         */
+        bool m_runChecks;
+
+        /**
+         * @brief Whether to also run the video tests on the quantised CPU backends, which doubles the number of video tests.
+         */
+        bool m_includeQuantisedBackEnds;
     };
 }
@@ -0,0 +1,10 @@
+#include <string>
+#include <vector>
+
+#include "ModelConverter.hpp"
+
+int main(int argc, char* argv[])
+{
+    LaneAndObjectDetection::ModelConverter modelConverter(std::vector<std::string>(argv, argv + argc));
+    modelConverter.ConvertModels();
+}
@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/dnn/dnn.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/videoio.hpp>
+
+#include "helpers/Globals.hpp"
+#include "helpers/ModelBundle.hpp"
+
+#include "ModelConverter.hpp"
+
+namespace LaneAndObjectDetection
+{
+    ModelConverter::ModelConverter(const std::vector<std::string>& p_commandLineArguments)
+    {
+        uint32_t index = 0;
+
+        for (const std::string& argument : p_commandLineArguments)
+        {
+            if (argument == "-h" || argument == "--help")
+            {
+                std::cout << Globals::G_MODEL_CONVERTER_CLI_HELP_MESSAGE;
+                std::exit(1);
+            }
+
+            try
+            {
+                if (argument == "-y" || argument == "--yolo-folder-path")
+                {
+                    m_yoloFolderPath = p_commandLineArguments.at(index + 1);
+                }
+
+                if (argument == "-c" || argument == "--calibration-input")
+                {
+                    m_calibrationInputVideoFilePath = p_commandLineArguments.at(index + 1);
+                }
+            }
+
+            catch (...)
+            {
+                std::cout << Globals::G_MODEL_CONVERTER_CLI_HELP_MESSAGE;
+                std::exit(1);
+            }
+
+            index++;
+        }
+
+        // Check that the required arguments have been provided
+        if (m_yoloFolderPath.empty())
+        {
+            std::cout << Globals::G_MODEL_CONVERTER_CLI_HELP_MESSAGE;
+            std::exit(1);
+        }
+    }
+
+    void ModelConverter::ConvertModels()
+    {
+        const std::array<std::string, 2> MODEL_NAMES = {Globals::G_YOLO_TINY_MODEL_NAME, Globals::G_YOLO_STANDARD_MODEL_NAME};
+        uint32_t numberOfConvertedModels = 0;
+
+        for (const std::string& modelName : MODEL_NAMES)
+        {
+            const std::string MODEL_FILE_PATH = m_yoloFolderPath + modelName;
+            const std::string CONFIGURATION_FILE_PATH = MODEL_FILE_PATH + Globals::G_MODEL_CFG_EXTENSION;
+            const std::string WEIGHTS_FILE_PATH = MODEL_FILE_PATH + Globals::G_MODEL_WEIGHTS_EXTENSION;
+            const std::string BUNDLE_FILE_PATH = MODEL_FILE_PATH + Globals::G_MODEL_BUNDLE_EXTENSION;
+
+            if (!std::filesystem::exists(CONFIGURATION_FILE_PATH) || !std::filesystem::exists(WEIGHTS_FILE_PATH))
+            {
+                std::cout << std::format("\nSkipping '{}' as its .cfg or .weights file cannot be found", modelName);
+                continue;
+            }
+
+            if (!ModelBundle::Write(CONFIGURATION_FILE_PATH, WEIGHTS_FILE_PATH, BUNDLE_FILE_PATH))
+            {
+                std::cout << std::format("\nERROR: Bundle '{}' could not be written!\n", BUNDLE_FILE_PATH);
+                std::exit(1);
+            }
+
+            // Read the bundle back the same way as the object detector to catch a corrupt bundle before it is deployed. The
+            // Darknet parser throws rather than returning an empty network for some corrupt bundles.
+            const auto IS_READABLE = [&BUNDLE_FILE_PATH]() {
+                ModelBundle modelBundle;
+
+                if (!modelBundle.Open(BUNDLE_FILE_PATH))
+                {
+                    return false;
+                }
+
+                try
+                {
+                    return !cv::dnn::readNetFromDarknet(modelBundle.GetConfiguration(), modelBundle.GetConfigurationSize(), modelBundle.GetWeights(), modelBundle.GetWeightsSize()).empty();
+                }
+
+                catch (const cv::Exception&)
+                {
+                    return false;
+                }
+            };
+
+            if (!IS_READABLE())
+            {
+                std::cout << std::format("\nERROR: Bundle '{}' could not be read back!\n", BUNDLE_FILE_PATH);
+                std::exit(1);
+            }
+
+            std::cout << std::format("\nWrote '{}' ({} bytes)", BUNDLE_FILE_PATH, std::filesystem::file_size(BUNDLE_FILE_PATH));
+            numberOfConvertedModels++;
+        }
+
+        if (numberOfConvertedModels == 0)
+        {
+            std::cout << std::format("\nERROR: No .cfg and .weights files were found in '{}'!\n", m_yoloFolderPath);
+            std::exit(1);
+        }
+
+        if (!m_calibrationInputVideoFilePath.empty())
+        {
+            ExtractCalibrationFrames();
+        }
+
+        std::cout << "\n";
+    }
+
+    void ModelConverter::ExtractCalibrationFrames()
+    {
+        cv::VideoCapture videoCapture;
+
+        if (!videoCapture.open(m_calibrationInputVideoFilePath))
+        {
+            std::cout << std::format("\nERROR: Calibration input video file path '{}' cannot be found!\n", m_calibrationInputVideoFilePath);
+            std::exit(1);
+        }
+
+        const std::filesystem::path CALIBRATION_FOLDER_PATH = m_yoloFolderPath + Globals::G_OBJECT_DETECTOR_CALIBRATION_FOLDER_NAME;
+        std::filesystem::create_directories(CALIBRATION_FOLDER_PATH);
+
+        // Sample frames evenly across the whole video so that the calibration covers all of its scenes. Every frame is read as
+        // seeking is not frame accurate for all codecs.
+        const uint64_t NUMBER_OF_FRAMES = Globals::G_OBJECT_DETECTOR_CALIBRATION_NUMBER_OF_FRAMES;
+        const uint64_t FRAME_COUNT = std::max<uint64_t>(static_cast<uint64_t>(videoCapture.get(cv::CAP_PROP_FRAME_COUNT)), NUMBER_OF_FRAMES);
+        uint64_t frameNumber = 0;
+        uint64_t numberOfWrittenFrames = 0;
+        cv::Mat frame;
+
+        while (numberOfWrittenFrames < NUMBER_OF_FRAMES && videoCapture.read(frame))
+        {
+            if (frameNumber == (numberOfWrittenFrames * FRAME_COUNT) / NUMBER_OF_FRAMES)
+            {
+                const std::filesystem::path FRAME_FILE_PATH = CALIBRATION_FOLDER_PATH / std::format("{:04}{}", numberOfWrittenFrames, Globals::G_OBJECT_DETECTOR_CALIBRATION_FRAME_EXTENSION);
+
+                if (!cv::imwrite(FRAME_FILE_PATH.string(), frame))
+                {
+                    std::cout << std::format("\nERROR: Calibration frame '{}' could not be written!\n", FRAME_FILE_PATH.string());
+                    std::exit(1);
+                }
+
+                numberOfWrittenFrames++;
+            }
+
+            frameNumber++;
+        }
+
+        if (numberOfWrittenFrames == 0)
+        {
+            std::cout << std::format("\nERROR: No frames could be read from '{}'!\n", m_calibrationInputVideoFilePath);
+            std::exit(1);
+        }
+
+        std::cout << std::format("\nWrote {} calibration frames to '{}'", numberOfWrittenFrames, CALIBRATION_FOLDER_PATH.string());
+    }
+}
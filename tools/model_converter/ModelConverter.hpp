@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * @namespace LaneAndObjectDetection
+ * @brief Contains all Lane-and-Object-Detection objects.
+ */
+namespace LaneAndObjectDetection
+{
+    /**
+     * @class ModelConverter
+     * @brief Converts the `.cfg` and `.weights` YOLO files of each model in a YOLO folder in to a model bundle, which the object
+     * detector loads in preference to the separate files.
+     */
+    class ModelConverter
+    {
+    public:
+        /**
+         * @brief Constructs a new %ModelConverter object (for CLI use).
+         *
+         * Usage: lane-and-object-detection-model-converter --yolo-folder-path ... [optional]
+         *
+         * OPTIONS:
+         *
+         * Generic Options:
+         *
+         * -h --help              Display available options
+         *
+         * Required Options:
+         *
+         * -y --yolo-folder-path  Path to the yolo folder, where a bundle is written next to each pair of .cfg and .weights files
+         *
+         * Optional Options:
+         *
+         * -c --calibration-input Video file path to sample INT8 calibration frames from in to the yolo folder (default = none)
+         *
+         * @param p_commandLineArguments List of all command line arguments.
+         */
+        explicit ModelConverter(const std::vector<std::string>& p_commandLineArguments);
+
+        /**
+         * @brief Writes a bundle for every model in the YOLO folder that has both a `.cfg` and `.weights` file, and checks that
+         * each bundle can be read back in to a network. Then, if a calibration input was given, extracts the INT8 calibration
+         * frames from it.
+         */
+        void ConvertModels();
+
+    private:
+        /**
+         * @brief Writes `Globals::G_OBJECT_DETECTOR_CALIBRATION_NUMBER_OF_FRAMES` frames, evenly spaced across the calibration
+         * input video, to the calibration folder within the YOLO folder for the INT8 backend to quantise the networks with.
+         */
+        void ExtractCalibrationFrames();
+
+        /**
+         * @brief The folder containing the `.cfg` and `.weights` YOLO files.
+         */
+        std::string m_yoloFolderPath;
+
+        /**
+         * @brief The file path of the video to sample the calibration frames from, or empty to not extract any.
+         */
+        std::string m_calibrationInputVideoFilePath;
+    };
+}